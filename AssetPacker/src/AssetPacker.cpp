@@ -0,0 +1,384 @@
+// Builds the asset pack the game maps at startup, see PackFormat.h.
+//
+//   AssetPacker [--compact] <asset folder> <pack file>
+//   AssetPacker --embed <asset folder> <header>
+//
+// e.g. AssetPacker RacingConsoleGame/assets RacingConsoleGame/assets.pak
+//
+// Every .spr and .wav below the folder is stored under the name the game
+// asks for it by, the folder name followed by the relative path, so
+// assets/cars/car1.spr. Files are checked the same way the game would load
+// them and anything it could not use is left out with a warning. v1 sprites
+// are converted to v2 so the game can use their cells in place, or with
+// --compact to the smaller palette and run-length encoding of SpriteCodec.h.
+//
+// --embed writes the sprites as constexpr arrays into a header instead, see
+// EmbeddedSprite.h, compact sprites expanded to all their cells. The game
+// project runs this before every build and the header is only rewritten
+// when an asset changed.
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../RacingConsoleGame/src/PackFormat.h"
+#include "../../RacingConsoleGame/src/SpriteFormat.h"
+#include "../../RacingConsoleGame/src/SpriteCodec.h"
+
+namespace fs = std::filesystem;
+
+struct sPackFile {
+	std::wstring sName;
+	fs::path path;
+	sPackEntry entry;
+	std::vector<char> data;
+};
+
+static bool ReadFile(const fs::path& path, std::vector<char>& data) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+		return false;
+	data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return true;
+}
+
+// Leaves data holding a checksummed v2 sprite, converting a v1 one. With
+// bCompact the cells are stored with the SpriteCodec encoding when that is
+// smaller, the game then keeps just the decoded spans in memory
+static bool ConvertSprite(std::vector<char>& data, bool bCompact) {
+	int32_t w = 0, h = 0;
+	std::vector<sSpriteCell> cells;
+
+	if (data.size() >= sizeof(sSpriteHeader) && memcmp(data.data(), SPRITE_MAGIC, 4) == 0) {
+		sSpriteHeader header;
+		memcpy(&header, data.data(), sizeof(header));
+		if (header.nVersion != SPRITE_VERSION || header.nWidth <= 0 || header.nHeight <= 0 ||
+			header.nCellOffset < sizeof(sSpriteHeader) || header.nCellOffset % sizeof(sSpriteCell) != 0)
+			return false;
+
+		size_t nDataSize = SpriteDataSize(header);
+		if (header.nCellOffset + nDataSize > data.size())
+			return false;
+
+		const char* pCellData = data.data() + header.nCellOffset;
+		if ((header.nFlags & SPRITE_CHECKSUM) && SpriteChecksum(pCellData, nDataSize) != header.nChecksum)
+			return false;
+
+		// Already compact, nothing to gain from decoding it again
+		if (header.nFlags & SPRITE_COMPACT) {
+			sSpriteSpans spans;
+			return DecodeSpriteCells(pCellData, nDataSize, header.nWidth, header.nHeight, spans);
+		}
+
+		w = header.nWidth;
+		h = header.nHeight;
+		if (nDataSize < (size_t) w * h * sizeof(sSpriteCell))
+			return false;
+		cells.resize(w * h);
+		memcpy(cells.data(), pCellData, cells.size() * sizeof(sSpriteCell));
+	} else {
+		// v1: width, height, then width * height colours and as many glyphs
+		if (data.size() < 2 * sizeof(int32_t))
+			return false;
+
+		memcpy(&w, data.data(), sizeof(int32_t));
+		memcpy(&h, data.data() + sizeof(int32_t), sizeof(int32_t));
+		if (w <= 0 || h <= 0 || data.size() < 2 * sizeof(int32_t) + (size_t) w * h * 2 * sizeof(int16_t))
+			return false;
+
+		cells.resize(w * h);
+		const char* pColours = data.data() + 2 * sizeof(int32_t);
+		const char* pGlyphs = pColours + w * h * sizeof(int16_t);
+		for (int i = 0; i < w * h; i++) {
+			memcpy(&cells[i].colour, pColours + i * sizeof(int16_t), sizeof(int16_t));
+			memcpy(&cells[i].glyph, pGlyphs + i * sizeof(int16_t), sizeof(int16_t));
+		}
+	}
+
+	std::vector<char> cellData;
+	bCompact = bCompact && EncodeSpriteCells(cells.data(), w, h, cellData) && cellData.size() < cells.size() * sizeof(sSpriteCell);
+	if (!bCompact)
+		cellData.assign((const char*) cells.data(), (const char*) (cells.data() + cells.size()));
+
+	sSpriteHeader header = {};
+	memcpy(header.magic, SPRITE_MAGIC, 4);
+	header.nVersion = SPRITE_VERSION;
+	header.nFlags = SPRITE_CHECKSUM | (bCompact ? SPRITE_COMPACT : 0);
+	header.nWidth = w;
+	header.nHeight = h;
+	header.nCellOffset = sizeof(sSpriteHeader);
+	header.nChecksum = SpriteChecksum(cellData.data(), cellData.size());
+	header.nDataSize = (uint32_t) cellData.size();
+
+	data.resize(sizeof(header) + cellData.size());
+	memcpy(data.data(), &header, sizeof(header));
+	memcpy(data.data() + sizeof(header), cellData.data(), cellData.size());
+	return true;
+}
+
+// The engine only plays 16-bit 44100Hz PCM
+static bool CheckSound(const std::vector<char>& data) {
+	if (data.size() < 12 || memcmp(data.data(), "RIFF", 4) != 0 || memcmp(data.data() + 8, "WAVE", 4) != 0)
+		return false;
+
+	size_t p = 12;
+	bool bFormat = false;
+	while (p + 8 <= data.size()) {
+		int32_t nChunksize = 0;
+		memcpy(&nChunksize, data.data() + p + 4, sizeof(int32_t));
+		if (nChunksize < 0 || p + 8 + nChunksize > data.size())
+			return false;
+
+		if (memcmp(data.data() + p, "fmt ", 4) == 0 && nChunksize >= 16) {
+			uint32_t nSamplesPerSec = 0;
+			uint16_t wBitsPerSample = 0;
+			memcpy(&nSamplesPerSec, data.data() + p + 12, sizeof(uint32_t));
+			memcpy(&wBitsPerSample, data.data() + p + 22, sizeof(uint16_t));
+			if (wBitsPerSample != 16 || nSamplesPerSec != 44100)
+				return false;
+			bFormat = true;
+		} else if (memcmp(data.data() + p, "data", 4) == 0) {
+			// PCM is read in place as shorts, so it must start on an even offset
+			return bFormat && (p + 8) % 2 == 0;
+		}
+
+		// Chunks are padded to an even length
+		p += 8 + nChunksize + (nChunksize & 1);
+	}
+	return false;
+}
+
+// Every cell of a checked v2 sprite, compact ones expanded the way the game
+// does with blank cells left as black spaces
+static bool ExpandSprite(const std::vector<char>& data, std::vector<sSpriteCell>& cells) {
+	sSpriteHeader header;
+	memcpy(&header, data.data(), sizeof(header));
+	const char* pCellData = data.data() + header.nCellOffset;
+	size_t nDataSize = SpriteDataSize(header);
+	cells.assign((size_t) header.nWidth * header.nHeight, sSpriteCell{0x0020, 0x0000});
+
+	if ((header.nFlags & SPRITE_COMPACT) == 0) {
+		if (nDataSize < cells.size() * sizeof(sSpriteCell))
+			return false;
+		memcpy(cells.data(), pCellData, cells.size() * sizeof(sSpriteCell));
+		return true;
+	}
+
+	sSpriteSpans spans;
+	if (!DecodeSpriteCells(pCellData, nDataSize, header.nWidth, header.nHeight, spans))
+		return false;
+	for (int y = 0; y < header.nHeight; y++) {
+		for (int s = spans.rowSpans[y]; s < spans.rowSpans[y + 1]; s++) {
+			const sSpriteSpan& span = spans.spans[s];
+			for (int i = 0; i < span.nLength; i++)
+				cells[y * header.nWidth + span.x + i] = spans.palette[spans.indices[span.nIndex + i]];
+		}
+	}
+	return true;
+}
+
+// Unrolling the blit pays off for sprites the size of a car, for a sheet
+// like a font atlas it would only bloat the code
+static const int MAX_FIXED_BLIT_CELLS = 512;
+
+// Every sprite as a sFixedSprite of its own size plus a table to find them by name
+static bool WriteEmbedded(const std::vector<sPackFile>& files, const char* sOutFile) {
+	std::ostringstream out;
+	std::set<std::pair<int, int>> sizes;
+
+	out << "// Generated by AssetPacker --embed, do not edit\n";
+	out << "#pragma once\n";
+	out << "#include \"EmbeddedSprite.h\"\n";
+
+	// By name, so the generated header diffs well when assets change
+	std::vector<const sPackFile*> sprites;
+	for (auto& file : files) {
+		if (file.entry.nType == PACK_SPRITE)
+			sprites.push_back(&file);
+	}
+	std::sort(sprites.begin(), sprites.end(), [] (const sPackFile* a, const sPackFile* b) {
+		return a->sName < b->sName;
+	});
+
+	std::vector<std::string> names;
+	for (const sPackFile* pFile : sprites) {
+		const sPackFile& file = *pFile;
+		sSpriteHeader header;
+		memcpy(&header, file.data.data(), sizeof(header));
+		std::vector<sSpriteCell> cells;
+		if (!ExpandSprite(file.data, cells)) {
+			fprintf(stderr, "ERROR: could not read the cells of %s\n", file.path.string().c_str());
+			return false;
+		}
+		if (header.nWidth * header.nHeight <= MAX_FIXED_BLIT_CELLS)
+			sizes.insert(std::make_pair((int) header.nWidth, (int) header.nHeight));
+
+		std::string sName = fs::path(file.sName).generic_string();
+		std::string sIdent = "EMBEDDED_";
+		for (char c : sName)
+			sIdent += isalnum((unsigned char) c) ? c : '_';
+		names.push_back(sIdent);
+
+		out << "\n// " << sName << "\n";
+		out << "constexpr sFixedSprite<" << header.nWidth << ", " << header.nHeight << "> " << sIdent << " = {{";
+		for (int i = 0; i < header.nWidth * header.nHeight; i++) {
+			const sSpriteCell& cell = cells[i];
+			out << (i % header.nWidth == 0 ? "\n\t" : " ");
+			char sCell[32];
+			snprintf(sCell, sizeof(sCell), "{0x%04X, 0x%04X},", cell.glyph, cell.colour);
+			out << sCell;
+		}
+		out << "\n}};\n";
+	}
+
+	// Sizes the engine instantiates fixed-size blitters for
+	out << "\n#define EMBEDDED_SPRITE_SIZES(X)";
+	for (auto& size : sizes)
+		out << " X(" << size.first << ", " << size.second << ")";
+	out << "\n";
+
+	out << "\nconstexpr sEmbeddedSprite EMBEDDED_SPRITES[] = {\n";
+	size_t n = 0;
+	for (const sPackFile* pFile : sprites) {
+		char sHash[16];
+		snprintf(sHash, sizeof(sHash), "0x%08X", pFile->entry.nHash);
+		out << "\t{" << sHash << "u, " << names[n] << ".Width(), " << names[n] << ".Height(), " << names[n] << ".cells},\n";
+		n++;
+	}
+	out << "};\n";
+
+	// Leave the header alone when nothing changed, it would rebuild the game for nothing
+	std::vector<char> old;
+	std::string sText = out.str();
+	if (ReadFile(sOutFile, old) && std::string(old.begin(), old.end()) == sText) {
+		printf("%s is up to date\n", sOutFile);
+		return true;
+	}
+
+	std::ofstream file(sOutFile, std::ios::binary | std::ios::trunc);
+	file << sText;
+	if (!file) {
+		fprintf(stderr, "ERROR: could not write %s\n", sOutFile);
+		return false;
+	}
+
+	printf("Embedded %d sprites into %s\n", (int) n, sOutFile);
+	return true;
+}
+
+int main(int argc, char** argv) {
+	bool bCompact = argc == 4 && strcmp(argv[1], "--compact") == 0;
+	bool bEmbed = argc == 4 && strcmp(argv[1], "--embed") == 0;
+	if (argc != 3 && !bCompact && !bEmbed) {
+		fprintf(stderr, "usage: AssetPacker [--compact] <asset folder> <pack file>\n");
+		fprintf(stderr, "       AssetPacker --embed <asset folder> <header>\n");
+		return 1;
+	}
+	const char* sFolder = argv[argc - 2];
+	const char* sOutFile = argv[argc - 1];
+
+	fs::path root = fs::path(sFolder).lexically_normal();
+	if (!root.has_filename())
+		root = root.parent_path();
+	if (!fs::is_directory(root)) {
+		fprintf(stderr, "ERROR: %s is not a folder\n", sFolder);
+		return 1;
+	}
+
+	std::vector<sPackFile> files;
+	for (auto& item : fs::recursive_directory_iterator(root)) {
+		if (!item.is_regular_file())
+			continue;
+
+		std::wstring sExt = item.path().extension().wstring();
+		std::transform(sExt.begin(), sExt.end(), sExt.begin(), towlower);
+
+		sPackFile file;
+		if (sExt == L".spr")
+			file.entry.nType = PACK_SPRITE;
+		else if (sExt == L".wav")
+			file.entry.nType = PACK_SOUND;
+		else
+			continue;
+
+		file.path = item.path();
+		file.sName = (root.filename() / item.path().lexically_relative(root)).generic_wstring();
+		if (!ReadFile(file.path, file.data)) {
+			fprintf(stderr, "ERROR: could not read %s\n", file.path.string().c_str());
+			return 1;
+		}
+
+		bool bValid = file.entry.nType == PACK_SPRITE ? ConvertSprite(file.data, bCompact) : CheckSound(file.data);
+		if (!bValid) {
+			fprintf(stderr, "WARNING: skipping %s, not a sprite or sound the game can load\n", file.path.string().c_str());
+			continue;
+		}
+
+		file.entry.nHash = PackHash(file.sName);
+		file.entry.nReserved = 0;
+		file.entry.nSize = (uint32_t) file.data.size();
+		files.push_back(std::move(file));
+	}
+
+	// The game binary searches the index, names are dropped so hashes must be unique
+	std::sort(files.begin(), files.end(), [] (const sPackFile& a, const sPackFile& b) {
+		return a.entry.nHash < b.entry.nHash;
+	});
+	for (size_t i = 1; i < files.size(); i++) {
+		if (files[i].entry.nHash == files[i - 1].entry.nHash) {
+			fprintf(stderr, "ERROR: %s and %s have the same name hash, rename one of them\n",
+				files[i - 1].path.string().c_str(), files[i].path.string().c_str());
+			return 1;
+		}
+	}
+
+	if (bEmbed)
+		return WriteEmbedded(files, sOutFile) ? 0 : 1;
+
+	// Lay the payloads out after the index
+	uint64_t nOffset = sizeof(sPackHeader) + files.size() * sizeof(sPackEntry);
+	for (auto& file : files) {
+		nOffset = (nOffset + PACK_ALIGN - 1) / PACK_ALIGN * PACK_ALIGN;
+		file.entry.nOffset = (uint32_t) nOffset;
+		nOffset += file.entry.nSize;
+	}
+	if (nOffset > UINT32_MAX) {
+		fprintf(stderr, "ERROR: pack would be larger than 4GB\n");
+		return 1;
+	}
+
+	std::ofstream out(sOutFile, std::ios::binary | std::ios::trunc);
+	if (!out) {
+		fprintf(stderr, "ERROR: could not create %s\n", sOutFile);
+		return 1;
+	}
+
+	sPackHeader header;
+	memcpy(header.magic, PACK_MAGIC, 4);
+	header.nVersion = PACK_VERSION;
+	header.nEntries = (uint32_t) files.size();
+	header.nReserved = 0;
+	out.write((const char*) &header, sizeof(header));
+
+	for (auto& file : files)
+		out.write((const char*) &file.entry, sizeof(sPackEntry));
+
+	const char padding[PACK_ALIGN] = {};
+	for (auto& file : files) {
+		out.write(padding, file.entry.nOffset - (uint32_t) out.tellp());
+		out.write(file.data.data(), file.data.size());
+	}
+
+	if (!out) {
+		fprintf(stderr, "ERROR: could not write %s\n", sOutFile);
+		return 1;
+	}
+
+	printf("Packed %d assets, %llu bytes, into %s\n", (int) files.size(), (unsigned long long) nOffset, sOutFile);
+	return 0;
+}
@@ -0,0 +1,218 @@
+#include "AssetCache.h"
+#include "EmbeddedSprite.h"
+#include <cwctype>
+
+AssetCache::AssetCache() {
+	m_nRequests = 0;
+	m_nLoads = 0;
+	m_nPacked = 0;
+	m_nEmbedded = 0;
+	m_nReloads = 0;
+	m_nGeneration = 0;
+}
+
+bool AssetCache::OpenPack(const std::wstring& sFile) {
+	std::shared_ptr<AssetPack> pPack = std::make_shared<AssetPack>();
+	if (!pPack->Open(sFile))
+		return false;
+
+	std::unique_lock<std::mutex> lm(m_mux);
+	m_pPack = pPack;
+	return true;
+}
+
+std::shared_ptr<const AssetPack> AssetCache::Pack() const {
+	std::unique_lock<std::mutex> lm(m_mux);
+	return m_pPack;
+}
+
+std::shared_ptr<const Sprite> AssetCache::LoadSprite(const std::wstring& sFile) {
+	SpriteFuture future;
+	SpritePromise promise;
+	if (Request(sFile, future, promise))
+		promise.set_value(Read(sFile));
+
+	return future.get();
+}
+
+AssetCache::SpriteFuture AssetCache::LoadSpriteAsync(ThreadPool& pool, const std::wstring& sFile) {
+	SpriteFuture future;
+	std::shared_ptr<SpritePromise> pPromise = std::make_shared<SpritePromise>();
+	if (Request(sFile, future, *pPromise))
+		pool.Submit([this, pPromise, sFile] { pPromise->set_value(Read(sFile)); });
+
+	return future;
+}
+
+bool AssetCache::Request(const std::wstring& sFile, SpriteFuture& future, SpritePromise& promise) {
+	std::wstring sKey = Key(sFile);
+
+	std::unique_lock<std::mutex> lm(m_mux);
+	m_nRequests++;
+
+	auto it = m_mapSprites.find(sKey);
+	if (it != m_mapSprites.end()) {
+		future = it->second;
+		return false;
+	}
+
+	// The entry goes in before the load starts, so nobody else reads the same file
+	future = promise.get_future().share();
+	m_mapSprites[sKey] = future;
+	return true;
+}
+
+std::shared_ptr<const Sprite> AssetCache::Read(const std::wstring& sFile) {
+	std::shared_ptr<AssetPack> pPack;
+	bool bChanged;
+	{
+		std::unique_lock<std::mutex> lm(m_mux);
+		pPack = m_pPack;
+		bChanged = m_setChanged.count(Key(sFile)) > 0;
+	}
+
+	// A file edited while the game runs is newer than any copy built in or packed
+	std::shared_ptr<const Sprite> sprite;
+	int* pCounter;
+	const sEmbeddedSprite* pEmbedded = bChanged ? nullptr : FindEmbeddedSprite(sFile);
+	if (pEmbedded != nullptr) {
+		sprite = std::make_shared<Sprite>(pEmbedded->nWidth, pEmbedded->nHeight, (const CHAR_INFO*) pEmbedded->pCells);
+		pCounter = &m_nEmbedded;
+	} else if (!bChanged && (sprite = FindPacked(pPack, sFile)) != nullptr) {
+		pCounter = &m_nPacked;
+	} else {
+		sprite = std::make_shared<Sprite>(sFile);
+		pCounter = &m_nLoads;
+	}
+
+	std::unique_lock<std::mutex> lm(m_mux);
+	(*pCounter)++;
+	return sprite;
+}
+
+std::shared_ptr<const Sprite> AssetCache::FindPacked(const std::shared_ptr<AssetPack>& pPack, const std::wstring& sFile) {
+	if (pPack == nullptr)
+		return nullptr;
+
+	size_t nSize = 0;
+	const char* pData = pPack->Find(sFile, PACK_SPRITE, nSize);
+	if (pData == nullptr)
+		return nullptr;
+
+	// v2 sprites reference the mapped cells, a v1 one left in the pack is converted
+	Sprite* pSprite = new Sprite();
+	if (!pSprite->Parse(pData, nSize, true)) {
+		delete pSprite;
+		return nullptr;
+	}
+
+	// The sprite keeps the pack mapped for as long as anyone holds it
+	return std::shared_ptr<const Sprite>(pSprite, [pPack] (const Sprite* p) { delete p; });
+}
+
+void AssetCache::ReloadAsync(ThreadPool& pool, const std::wstring& sFile) {
+	std::wstring sKey = Key(sFile);
+	{
+		std::unique_lock<std::mutex> lm(m_mux);
+		m_setChanged.insert(sKey);
+		if (m_mapSprites.count(sKey) == 0)
+			return;
+	}
+
+	pool.Submit([this, sFile, sKey] {
+		// A file caught half written fails to load, the rest of the write
+		// brings another change and with it another attempt
+		std::shared_ptr<Sprite> pSprite = std::make_shared<Sprite>();
+		if (!pSprite->Load(sFile))
+			return;
+
+		std::unique_lock<std::mutex> lm(m_mux);
+		m_vecReloaded.push_back(std::make_pair(sKey, std::shared_ptr<const Sprite>(pSprite)));
+	});
+}
+
+int AssetCache::ApplyReloads() {
+	std::unique_lock<std::mutex> lm(m_mux);
+
+	int nApplied = 0;
+	for (auto it = m_vecReloaded.begin(); it != m_vecReloaded.end();) {
+		auto entry = m_mapSprites.find(it->first);
+		if (entry != m_mapSprites.end()) {
+			// The first load has not even finished, try again next frame
+			if (!IsReady(entry->second)) {
+				++it;
+				continue;
+			}
+
+			// Handles already given out keep the old sprite until their
+			// holders see Generation() move and ask for it again
+			SpritePromise promise;
+			promise.set_value(it->second);
+			entry->second = promise.get_future().share();
+			m_nReloads++;
+			nApplied++;
+		}
+		it = m_vecReloaded.erase(it);
+	}
+
+	if (nApplied > 0)
+		m_nGeneration++;
+	return nApplied;
+}
+
+unsigned int AssetCache::Generation() const {
+	return m_nGeneration;
+}
+
+void AssetCache::Trim() {
+	std::unique_lock<std::mutex> lm(m_mux);
+	bool bErased = false;
+	for (auto it = m_mapSprites.begin(); it != m_mapSprites.end();) {
+		if (IsReady(it->second) && it->second.get().use_count() == 1) {
+			it = m_mapSprites.erase(it);
+			bErased = true;
+		} else {
+			++it;
+		}
+	}
+
+	// A freed sprite's address can come back for another one
+	if (bErased)
+		m_nGeneration++;
+}
+
+sAssetStats AssetCache::Stats() const {
+	std::unique_lock<std::mutex> lm(m_mux);
+
+	sAssetStats stats;
+	stats.nRequests = m_nRequests;
+	stats.nLoads = m_nLoads;
+	stats.nPacked = m_nPacked;
+	stats.nEmbedded = m_nEmbedded;
+	stats.nReloads = m_nReloads;
+	for (auto& s : m_mapSprites) {
+		if (!IsReady(s.second))
+			continue;
+
+		stats.nSprites++;
+		stats.nBytes += s.second.get()->Bytes();
+	}
+	return stats;
+}
+
+void AssetCache::Report() const {
+	sAssetStats stats = Stats();
+	wprintf(L"assets: %d sprite requests, %d loads, %d from pack, %d built in, %d reloaded, %d sprites held, %zu bytes\n",
+			stats.nRequests, stats.nLoads, stats.nPacked, stats.nEmbedded, stats.nReloads, stats.nSprites, stats.nBytes);
+}
+
+std::wstring AssetCache::Key(const std::wstring& sFile) {
+	std::wstring sKey = sFile;
+	for (auto& c : sKey) {
+		if (c == L'\\')
+			c = L'/';
+		else
+			c = (wchar_t) towlower(c);
+	}
+	return sKey;
+}
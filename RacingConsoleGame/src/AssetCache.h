@@ -0,0 +1,101 @@
+#pragma once
+#include "ConsoleGameEngine.h"
+#include "AssetPack.h"
+#include "ThreadPool.h"
+#include <string>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <future>
+#include <unordered_map>
+#include <unordered_set>
+
+struct sAssetStats {
+	int nRequests = 0;		// LoadSprite() and LoadSpriteAsync() calls
+	int nLoads = 0;			// files actually read
+	int nPacked = 0;		// sprites served from the asset pack instead
+	int nEmbedded = 0;		// sprites compiled into the game
+	int nReloads = 0;		// sprites replaced after their file changed
+	int nSprites = 0;		// sprites currently held, not counting ones still loading
+	size_t nBytes = 0;		// cell data of the sprites currently held
+};
+
+// Loads every sprite file once and hands out shared, read-only handles to it.
+// The cache keeps its own reference, so a sprite stays loaded until Trim()
+// finds nobody else using it. Safe to share between engines on different
+// threads, e.g. all sessions of a batch simulation.
+//
+// Sprites built into the game (EmbeddedSprite.h) come first, then the asset
+// pack if one is open, whose sprites are views into the mapped pack. Loose
+// files are only read for what neither has.
+//
+// LoadSpriteAsync() does the reading on a worker pool instead. Requests for a
+// sprite that is still loading wait for that one load rather than start another.
+class AssetCache {
+public:
+	typedef std::shared_future<std::shared_ptr<const Sprite>> SpriteFuture;
+
+	AssetCache();
+
+	AssetCache(const AssetCache&) = delete;
+	AssetCache& operator=(const AssetCache&) = delete;
+
+	// Call before the first load. Returns false, and keeps using loose
+	// files, if the pack is missing or damaged
+	bool OpenPack(const std::wstring& sFile);
+	std::shared_ptr<const AssetPack> Pack() const;
+
+	// Same fallback as Sprite(sFile): a missing file gives a blank 8x8 sprite
+	std::shared_ptr<const Sprite> LoadSprite(const std::wstring& sFile);
+
+	// Returns at once, the sprite is read on one of pool's workers. The
+	// cache has to outlive the work queued on pool
+	SpriteFuture LoadSpriteAsync(ThreadPool& pool, const std::wstring& sFile);
+
+	// Hot reload. ReloadAsync() reads sFile again on pool if the cache holds
+	// it, ApplyReloads() then puts the new sprite in its place and moves
+	// Generation() on. Handles already given out still point at the old
+	// sprite, which stays untouched, holders load sFile again to pick up the
+	// change. From then on sFile is read from the loose file ahead of the
+	// built-in and packed copies
+	void ReloadAsync(ThreadPool& pool, const std::wstring& sFile);
+	int ApplyReloads();
+
+	// Goes up whenever ApplyReloads() replaced a sprite or Trim() freed one,
+	// for anything that holds sprites or keeps something drawn from them,
+	// e.g. Car and Font
+	unsigned int Generation() const;
+
+	// Drop the loaded sprites no handle refers to any more
+	void Trim();
+
+	sAssetStats Stats() const;
+	void Report() const;
+
+private:
+	// Paths differing only by case or slash direction are the same file on Windows
+	static std::wstring Key(const std::wstring& sFile);
+
+	typedef std::promise<std::shared_ptr<const Sprite>> SpritePromise;
+
+	// Hands out the future of sFile's entry. Returns true when the entry was
+	// just made and the caller has to fulfil promise with Read(sFile)
+	bool Request(const std::wstring& sFile, SpriteFuture& future, SpritePromise& promise);
+
+	// Does the actual loading, without holding the lock
+	std::shared_ptr<const Sprite> Read(const std::wstring& sFile);
+
+	static std::shared_ptr<const Sprite> FindPacked(const std::shared_ptr<AssetPack>& pPack, const std::wstring& sFile);
+
+	mutable std::mutex m_mux;
+	std::shared_ptr<AssetPack> m_pPack;
+	std::unordered_map<std::wstring, SpriteFuture> m_mapSprites;
+	std::unordered_set<std::wstring> m_setChanged;
+	std::vector<std::pair<std::wstring, std::shared_ptr<const Sprite>>> m_vecReloaded;
+	int m_nRequests;
+	int m_nLoads;
+	int m_nPacked;
+	int m_nEmbedded;
+	int m_nReloads;
+	std::atomic<unsigned int> m_nGeneration;
+};
@@ -0,0 +1,104 @@
+#include "AssetPack.h"
+#include <algorithm>
+#include <cstring>
+
+AssetPack::AssetPack() {
+	m_hFile = INVALID_HANDLE_VALUE;
+	m_hMapping = NULL;
+	m_pData = nullptr;
+	m_nSize = 0;
+	m_pIndex = nullptr;
+	m_nEntries = 0;
+}
+
+AssetPack::~AssetPack() {
+	Close();
+}
+
+bool AssetPack::Open(const std::wstring& sFile) {
+	Close();
+
+	m_hFile = CreateFileW(sFile.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (m_hFile == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(m_hFile, &size) || size.QuadPart < (LONGLONG) sizeof(sPackHeader)) {
+		Close();
+		return false;
+	}
+	m_nSize = (size_t) size.QuadPart;
+
+	m_hMapping = CreateFileMappingW(m_hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (m_hMapping == NULL) {
+		Close();
+		return false;
+	}
+
+	m_pData = (const char*) MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0);
+	if (m_pData == nullptr) {
+		Close();
+		return false;
+	}
+
+	// Validate the header and every entry once, Find() trusts them afterwards
+	const sPackHeader* pHeader = (const sPackHeader*) m_pData;
+	if (memcmp(pHeader->magic, PACK_MAGIC, 4) != 0 || pHeader->nVersion != PACK_VERSION ||
+		sizeof(sPackHeader) + (size_t) pHeader->nEntries * sizeof(sPackEntry) > m_nSize) {
+		Close();
+		return false;
+	}
+
+	m_pIndex = (const sPackEntry*) (m_pData + sizeof(sPackHeader));
+	m_nEntries = pHeader->nEntries;
+	for (uint32_t i = 0; i < m_nEntries; i++) {
+		if ((size_t) m_pIndex[i].nOffset + m_pIndex[i].nSize > m_nSize ||
+			(i > 0 && m_pIndex[i - 1].nHash >= m_pIndex[i].nHash)) {
+			Close();
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void AssetPack::Close() {
+	if (m_pData != nullptr)
+		UnmapViewOfFile(m_pData);
+	if (m_hMapping != NULL)
+		CloseHandle(m_hMapping);
+	if (m_hFile != INVALID_HANDLE_VALUE)
+		CloseHandle(m_hFile);
+
+	m_hFile = INVALID_HANDLE_VALUE;
+	m_hMapping = NULL;
+	m_pData = nullptr;
+	m_nSize = 0;
+	m_pIndex = nullptr;
+	m_nEntries = 0;
+}
+
+bool AssetPack::IsOpen() const {
+	return m_pData != nullptr;
+}
+
+int AssetPack::Count() const {
+	return (int) m_nEntries;
+}
+
+const char* AssetPack::Find(const std::wstring& sName, PACK_ASSET_TYPE type, size_t& nSize) const {
+	nSize = 0;
+	if (m_pIndex == nullptr)
+		return nullptr;
+
+	uint32_t nHash = PackHash(sName);
+	const sPackEntry* pEnd = m_pIndex + m_nEntries;
+	const sPackEntry* pEntry = std::lower_bound(m_pIndex, pEnd, nHash,
+		[] (const sPackEntry& e, uint32_t h) { return e.nHash < h; });
+
+	if (pEntry == pEnd || pEntry->nHash != nHash || pEntry->nType != type)
+		return nullptr;
+
+	nSize = pEntry->nSize;
+	return m_pData + pEntry->nOffset;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "PackFormat.h"
+#include <windows.h>
+#include <string>
+
+// Read-only view of a pack built by AssetPacker. Open() maps the whole file
+// once, Find() is a binary search of the index and hands back a pointer
+// straight into the mapping, so nothing is read or copied until it is used.
+// Pointers stay valid until Close() or the pack is destroyed.
+class AssetPack {
+public:
+	AssetPack();
+	~AssetPack();
+
+	AssetPack(const AssetPack&) = delete;
+	AssetPack& operator=(const AssetPack&) = delete;
+
+	bool Open(const std::wstring& sFile);
+	void Close();
+
+	bool IsOpen() const;
+	int Count() const;
+
+	// nullptr when the pack has no asset of that name and type
+	const char* Find(const std::wstring& sName, PACK_ASSET_TYPE type, size_t& nSize) const;
+
+private:
+	HANDLE m_hFile;
+	HANDLE m_hMapping;
+	const char* m_pData;
+	size_t m_nSize;
+	const sPackEntry* m_pIndex;
+	uint32_t m_nEntries;
+};
@@ -0,0 +1,104 @@
+#include "AssetWatcher.h"
+
+namespace {
+	// How long a file has to stay untouched before it counts as written
+	const std::chrono::milliseconds SETTLE_TIME(100);
+}
+
+AssetWatcher::AssetWatcher() {
+	m_hFolder = INVALID_HANDLE_VALUE;
+	m_hStop = nullptr;
+}
+
+AssetWatcher::~AssetWatcher() {
+	Stop();
+}
+
+bool AssetWatcher::Start(const std::wstring& sFolder) {
+	Stop();
+
+	m_hFolder = CreateFileW(sFolder.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+							nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+	if (m_hFolder == INVALID_HANDLE_VALUE)
+		return false;
+
+	m_hStop = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+	m_sFolder = sFolder;
+	m_thread = std::thread(&AssetWatcher::WatchThread, this);
+	return true;
+}
+
+void AssetWatcher::Stop() {
+	if (m_thread.joinable()) {
+		SetEvent(m_hStop);
+		m_thread.join();
+	}
+
+	if (m_hFolder != INVALID_HANDLE_VALUE)
+		CloseHandle(m_hFolder);
+	if (m_hStop != nullptr)
+		CloseHandle(m_hStop);
+	m_hFolder = INVALID_HANDLE_VALUE;
+	m_hStop = nullptr;
+}
+
+std::vector<std::wstring> AssetWatcher::TakeChanges() {
+	std::vector<std::wstring> vecFiles;
+	auto now = std::chrono::steady_clock::now();
+
+	std::unique_lock<std::mutex> lm(m_mux);
+	for (auto it = m_mapChanged.begin(); it != m_mapChanged.end();) {
+		if (now - it->second >= SETTLE_TIME) {
+			vecFiles.push_back(it->first);
+			it = m_mapChanged.erase(it);
+		} else
+			++it;
+	}
+	return vecFiles;
+}
+
+void AssetWatcher::WatchThread() {
+	// DWORD aligned, as ReadDirectoryChangesW requires
+	DWORD buffer[4096];
+
+	OVERLAPPED ov;
+	ZeroMemory(&ov, sizeof(ov));
+	ov.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+	HANDLE handles[2] = {ov.hEvent, m_hStop};
+
+	while (true) {
+		if (!ReadDirectoryChangesW(m_hFolder, buffer, sizeof(buffer), TRUE,
+								   FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME, nullptr, &ov, nullptr))
+			break;
+
+		if (WaitForMultipleObjects(2, handles, FALSE, INFINITE) != WAIT_OBJECT_0) {
+			CancelIoEx(m_hFolder, &ov);
+			DWORD nIgnored = 0;
+			GetOverlappedResult(m_hFolder, &ov, &nIgnored, TRUE);
+			break;
+		}
+
+		// Zero bytes means the buffer overflowed and the changes were lost,
+		// there is nothing better to do than wait for the next ones
+		DWORD nBytes = 0;
+		if (!GetOverlappedResult(m_hFolder, &ov, &nBytes, FALSE))
+			break;
+
+		auto now = std::chrono::steady_clock::now();
+		std::unique_lock<std::mutex> lm(m_mux);
+		const char* p = (const char*) buffer;
+		while (nBytes > 0) {
+			const FILE_NOTIFY_INFORMATION* pInfo = (const FILE_NOTIFY_INFORMATION*) p;
+			if (pInfo->Action == FILE_ACTION_MODIFIED || pInfo->Action == FILE_ACTION_ADDED || pInfo->Action == FILE_ACTION_RENAMED_NEW_NAME) {
+				std::wstring sName(pInfo->FileName, pInfo->FileName + pInfo->FileNameLength / sizeof(WCHAR));
+				m_mapChanged[m_sFolder + L"/" + sName] = now;
+			}
+
+			if (pInfo->NextEntryOffset == 0)
+				break;
+			p += pInfo->NextEntryOffset;
+		}
+	}
+
+	CloseHandle(ov.hEvent);
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <windows.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <atomic>
+
+// Watches a folder and everything below it for files being written, on a
+// thread of its own blocked in ReadDirectoryChangesW. Editors tend to write a
+// file in several steps, so a file is only reported once it has been left
+// alone for a moment.
+class AssetWatcher {
+public:
+	AssetWatcher();
+	~AssetWatcher();
+
+	AssetWatcher(const AssetWatcher&) = delete;
+	AssetWatcher& operator=(const AssetWatcher&) = delete;
+
+	// Returns false if sFolder cannot be watched
+	bool Start(const std::wstring& sFolder);
+	void Stop();
+
+	// Files that changed since the last call, as sFolder + L"/" + the path
+	// below it. Never blocks
+	std::vector<std::wstring> TakeChanges();
+
+private:
+	void WatchThread();
+
+	std::wstring m_sFolder;
+	HANDLE m_hFolder;
+	HANDLE m_hStop;
+	std::thread m_thread;
+
+	std::mutex m_mux;
+	std::map<std::wstring, std::chrono::steady_clock::time_point> m_mapChanged;
+};
@@ -6,23 +6,49 @@ Car::Car() {
 	this->y = 0;
 	this->width = 0;
 	this->height = 0;
+	this->angle = 0;
 }
 
-Car::Car(std::wstring sFile) {
-	this->pSprite = new Sprite(sFile);
+Car::Car(std::shared_ptr<const Sprite> sprite) {
 	this->x = 0;
 	this->y = 0;
-	this->width = pSprite->nWidth;
-	this->height = pSprite->nHeight;
+	this->angle = 0;
+	SetSprite(sprite);
 }
 
-Car::~Car() {
-	delete pSprite;
+void Car::DrawSelf(ConsoleGameEngine* engine) const {
+	if (this->pSprite != nullptr && this->angle != 0)
+		engine->DrawSpriteTransformed(this->x, this->y, this->pSprite.get(), this->angle);
+	else if (this->pSprite != nullptr)
+		engine->DrawSprite(this->x, this->y, this->pSprite.get());
+	else
+		engine->Fill(this->x, this->y, this->Right(), this->Bottom(), PIXEL_SOLID, FG_BLUE);
 }
 
-void Car::DrawSelf(ConsoleGameEngine* engine) const {
+void Car::DrawSelf(DrawList& list, int nLayer) const {
 	if (this->pSprite != nullptr)
-		engine->DrawSprite(this->x, this->y, this->pSprite);
+		list.DrawSprite(nLayer, this->x, this->y, this->pSprite.get());
 	else
-		engine->Fill(this->x, this->y, this->Right(), this->Bottom(), PIXEL_SOLID, FG_BLUE);
+		list.Fill(nLayer, this->x, this->y, this->Right(), this->Bottom(), PIXEL_SOLID, FG_BLUE);
+}
+
+const Sprite* Car::GetSprite() const {
+	return this->pSprite.get();
 }
+
+void Car::SetSprite(std::shared_ptr<const Sprite> sprite) {
+	this->pSprite = sprite;
+	if (this->pSprite == nullptr)
+		return;
+
+	this->width = pSprite->nWidth;
+	this->height = pSprite->nHeight;
+}
+
+void Car::SetAngle(float angle) {
+	this->angle = angle;
+}
+
+float Car::Angle() const {
+	return this->angle;
+}
\ No newline at end of file
@@ -5,12 +5,23 @@
 class Car : public Rect {
 public:
 	Car();
-	Car(std::wstring sFile);
-	~Car();
+	Car(std::shared_ptr<const Sprite> sprite);
 
 public:
 	void DrawSelf(ConsoleGameEngine* engine) const;
+	void DrawSelf(DrawList& list, int nLayer) const;
+	const Sprite* GetSprite() const;
+
+	// Draw the car with sprite from now on, e.g. a reloaded copy, and take
+	// its size
+	void SetSprite(std::shared_ptr<const Sprite> sprite);
+
+	// Clockwise turn in radians the car is drawn with, it still collides
+	// as the upright rectangle
+	void SetAngle(float angle);
+	float Angle() const;
 
 protected:
-	Sprite* pSprite;
+	std::shared_ptr<const Sprite> pSprite;
+	float angle;
 };
\ No newline at end of file
@@ -1,4 +1,21 @@
 #include "ConsoleGameEngine.h"
+#include "AssetCache.h"
+#include "EmbeddedSprite.h"
+#include "ThreadPool.h"
+#include "AssetWatcher.h"
+#include "SpriteAtlas.h"
+#include "SpriteVariants.h"
+#include "ScreenLayer.h"
+#include <algorithm>
+#include <cmath>
+#include <climits>
+
+static_assert(sizeof(CHAR_INFO) == sizeof(sSpriteCell), "v2 sprite cells must be laid out like CHAR_INFO");
+
+uint64_t Sprite::NextVersion() {
+	static std::atomic<uint64_t> nVersions(0);
+	return ++nVersions;
+}
 
 Sprite::Sprite() {
 
@@ -13,73 +30,277 @@ Sprite::Sprite(std::wstring sFile) {
 		Create(8, 8);
 }
 
+Sprite::Sprite(int w, int h, const CHAR_INFO* pCells) {
+	nWidth = w;
+	nHeight = h;
+	m_Cells = const_cast<CHAR_INFO*>(pCells);
+	m_bOwned = false;
+}
+
+Sprite::~Sprite() {
+	Release();
+}
+
+Sprite& Sprite::operator=(Sprite&& other) {
+	if (this == &other)
+		return *this;
+
+	Release();
+	nWidth = other.nWidth;
+	nHeight = other.nHeight;
+	m_Cells = other.m_Cells;
+	m_bOwned = other.m_bOwned;
+	m_pSpans = std::move(other.m_pSpans);
+
+	other.nWidth = 0;
+	other.nHeight = 0;
+	other.m_Cells = nullptr;
+	other.m_bOwned = true;
+	other.m_nVersion = NextVersion();
+	return *this;
+}
+
+uint64_t Sprite::Version() const {
+	return m_nVersion;
+}
+
+void Sprite::Release() {
+	if (m_bOwned)
+		delete[] m_Cells;
+	m_Cells = nullptr;
+	m_bOwned = true;
+	m_pSpans.reset();
+	m_nVersion = NextVersion();
+}
+
+void Sprite::Detach() {
+	if (m_pSpans != nullptr) {
+		// Expand the spans back into a full set of cells
+		std::unique_ptr<sSpriteSpans> pSpans = std::move(m_pSpans);
+		Create(nWidth, nHeight);
+		for (int y = 0; y < nHeight; y++) {
+			for (int s = pSpans->rowSpans[y]; s < pSpans->rowSpans[y + 1]; s++) {
+				const sSpriteSpan& span = pSpans->spans[s];
+				for (int i = 0; i < span.nLength; i++) {
+					const sSpriteCell& cell = pSpans->palette[pSpans->indices[span.nIndex + i]];
+					m_Cells[y * nWidth + span.x + i].Char.UnicodeChar = cell.glyph;
+					m_Cells[y * nWidth + span.x + i].Attributes = cell.colour;
+				}
+			}
+		}
+		return;
+	}
+
+	if (m_bOwned)
+		return;
+
+	CHAR_INFO* pCells = new CHAR_INFO[nWidth * nHeight];
+	memcpy(pCells, m_Cells, Bytes());
+	m_Cells = pCells;
+	m_bOwned = true;
+}
+
+const sSpriteCell* Sprite::FindSpanCell(int x, int y) const {
+	for (int s = m_pSpans->rowSpans[y]; s < m_pSpans->rowSpans[y + 1]; s++) {
+		const sSpriteSpan& span = m_pSpans->spans[s];
+		if (x >= span.x && x < span.x + span.nLength)
+			return &m_pSpans->palette[m_pSpans->indices[span.nIndex + x - span.x]];
+	}
+	return nullptr;
+}
+
 void Sprite::Create(int w, int h) {
 	nWidth = w;
 	nHeight = h;
-	m_Glyphs = new short[w * h];
-	m_Colours = new short[w * h];
+	m_Cells = new CHAR_INFO[w * h];
 	for (int i = 0; i < w * h; i++) {
-		m_Glyphs[i] = L' ';
-		m_Colours[i] = FG_BLACK;
+		m_Cells[i].Char.UnicodeChar = L' ';
+		m_Cells[i].Attributes = FG_BLACK;
 	}
 }
 
 void Sprite::SetGlyph(int x, int y, short c) {
 	if (x < 0 || x >= nWidth || y < 0 || y >= nHeight)
 		return;
-	else
-		m_Glyphs[y * nWidth + x] = c;
+	Detach();
+	m_Cells[y * nWidth + x].Char.UnicodeChar = c;
+	m_nVersion = NextVersion();
 }
 
 void Sprite::SetColour(int x, int y, short c) {
 	if (x < 0 || x >= nWidth || y < 0 || y >= nHeight)
 		return;
-	else
-		m_Colours[y * nWidth + x] = c;
+	Detach();
+	m_Cells[y * nWidth + x].Attributes = c;
+	m_nVersion = NextVersion();
 }
 
-short Sprite::GetGlyph(int x, int y) {
+short Sprite::GetGlyph(int x, int y) const {
 	if (x < 0 || x >= nWidth || y < 0 || y >= nHeight)
 		return L' ';
-	else
-		return m_Glyphs[y * nWidth + x];
+	else if (m_pSpans != nullptr) {
+		const sSpriteCell* pCell = FindSpanCell(x, y);
+		return pCell != nullptr ? pCell->glyph : L' ';
+	} else
+		return m_Cells[y * nWidth + x].Char.UnicodeChar;
 }
 
-short Sprite::GetColour(int x, int y) {
+short Sprite::GetColour(int x, int y) const {
 	if (x < 0 || x >= nWidth || y < 0 || y >= nHeight)
 		return FG_BLACK;
-	else
-		return m_Colours[y * nWidth + x];
+	else if (m_pSpans != nullptr) {
+		const sSpriteCell* pCell = FindSpanCell(x, y);
+		return pCell != nullptr ? pCell->colour : FG_BLACK;
+	} else
+		return m_Cells[y * nWidth + x].Attributes;
 }
 
-short Sprite::SampleGlyph(float x, float y) {
+short Sprite::SampleGlyph(float x, float y) const {
 	int sx = (int) (x * (float) nWidth);
 	int sy = (int) (y * (float) nHeight - 1.0f);
-	if (sx < 0 || sx >= nWidth || sy < 0 || sy >= nHeight)
-		return L' ';
-	else
-		return m_Glyphs[sy * nWidth + sx];
+	return GetGlyph(sx, sy);
 }
 
-short Sprite::SampleColour(float x, float y) {
+short Sprite::SampleColour(float x, float y) const {
 	int sx = (int) (x * (float) nWidth);
 	int sy = (int) (y * (float) nHeight - 1.0f);
-	if (sx < 0 || sx >= nWidth || sy < 0 || sy >= nHeight)
-		return FG_BLACK;
-	else
-		return m_Colours[sy * nWidth + sx];
+	return GetColour(sx, sy);
+}
+
+namespace {
+	// Points are turned into cell coordinates this many at a time
+	const int SAMPLE_BATCH = 64;
 }
 
-bool Sprite::Save(std::wstring sFile) {
+void Sprite::SampleSpan(float x, float y, float dx, float dy, int nCount, CHAR_INFO* pOut, SAMPLE_MODE mode) const {
+	int sx[SAMPLE_BATCH];
+	int sy[SAMPLE_BATCH];
+	for (int n = 0; n < nCount; n += SAMPLE_BATCH) {
+		int nBatch = std::min(SAMPLE_BATCH, nCount - n);
+
+		// Same arithmetic as SampleGlyph(), so the same cells come out
+		for (int i = 0; i < nBatch; i++) {
+			sx[i] = (int) ((x + (n + i) * dx) * (float) nWidth);
+			sy[i] = (int) ((y + (n + i) * dy) * (float) nHeight - 1.0f);
+		}
+		SampleCells(sx, sy, nBatch, pOut + n, mode);
+	}
+}
+
+void Sprite::SampleSpan(const float* pX, const float* pY, int nCount, CHAR_INFO* pOut, SAMPLE_MODE mode) const {
+	int sx[SAMPLE_BATCH];
+	int sy[SAMPLE_BATCH];
+	for (int n = 0; n < nCount; n += SAMPLE_BATCH) {
+		int nBatch = std::min(SAMPLE_BATCH, nCount - n);
+		for (int i = 0; i < nBatch; i++) {
+			sx[i] = (int) (pX[n + i] * (float) nWidth);
+			sy[i] = (int) (pY[n + i] * (float) nHeight - 1.0f);
+		}
+		SampleCells(sx, sy, nBatch, pOut + n, mode);
+	}
+}
+
+void Sprite::SampleCells(const int* pX, const int* pY, int nCount, CHAR_INFO* pOut, SAMPLE_MODE mode) const {
+	CHAR_INFO blank;
+	blank.Char.UnicodeChar = L' ';
+	blank.Attributes = FG_BLACK;
+
+	if (nWidth <= 0 || nHeight <= 0) {
+		for (int i = 0; i < nCount; i++)
+			pOut[i] = blank;
+		return;
+	}
+
+	// Bring every point onto the sprite, SAMPLE_BORDER clamps as well and
+	// blanks the points that were off it afterwards. Kept free of branches
+	// apart from wrapping, so the compiler can vectorise it
+	int index[SAMPLE_BATCH];
+	int inside[SAMPLE_BATCH];
+	if (mode == SAMPLE_WRAP) {
+		for (int i = 0; i < nCount; i++) {
+			int x = ((pX[i] % nWidth) + nWidth) % nWidth;
+			int y = ((pY[i] % nHeight) + nHeight) % nHeight;
+			index[i] = y * nWidth + x;
+		}
+	} else {
+		for (int i = 0; i < nCount; i++) {
+			int x = pX[i];
+			int y = pY[i];
+			inside[i] = (x >= 0) & (x < nWidth) & (y >= 0) & (y < nHeight);
+			x = std::min(std::max(x, 0), nWidth - 1);
+			y = std::min(std::max(y, 0), nHeight - 1);
+			index[i] = y * nWidth + x;
+		}
+	}
+
+	if (m_Cells == nullptr) {
+		for (int i = 0; i < nCount; i++) {
+			pOut[i].Char.UnicodeChar = GetGlyph(index[i] % nWidth, index[i] / nWidth);
+			pOut[i].Attributes = GetColour(index[i] % nWidth, index[i] / nWidth);
+		}
+	} else {
+		for (int i = 0; i < nCount; i++)
+			pOut[i] = m_Cells[index[i]];
+	}
+
+	if (mode == SAMPLE_BORDER) {
+		for (int i = 0; i < nCount; i++) {
+			if (!inside[i])
+				pOut[i] = blank;
+		}
+	}
+}
+
+const CHAR_INFO* Sprite::Cells() const {
+	return m_Cells;
+}
+
+const sSpriteSpans* Sprite::Spans() const {
+	return m_pSpans.get();
+}
+
+bool Sprite::IsCompact() const {
+	return m_pSpans != nullptr;
+}
+
+size_t Sprite::Bytes() const {
+	if (m_pSpans != nullptr)
+		return m_pSpans->Bytes();
+	return (size_t) nWidth * nHeight * sizeof(CHAR_INFO);
+}
+
+bool Sprite::Save(std::wstring sFile, bool bCompact) const {
+	// Cells as they go to a file, in either encoding
+	std::vector<sSpriteCell> cells(nWidth * nHeight);
+	for (int y = 0; y < nHeight; y++) {
+		for (int x = 0; x < nWidth; x++) {
+			cells[y * nWidth + x].glyph = GetGlyph(x, y);
+			cells[y * nWidth + x].colour = GetColour(x, y);
+		}
+	}
+
+	std::vector<char> data;
+	bCompact = bCompact && EncodeSpriteCells(cells.data(), nWidth, nHeight, data) && data.size() < cells.size() * sizeof(sSpriteCell);
+	if (!bCompact)
+		data.assign((const char*) cells.data(), (const char*) (cells.data() + cells.size()));
+
 	FILE* f = nullptr;
 	_wfopen_s(&f, sFile.c_str(), L"wb");
 	if (f == nullptr)
 		return false;
 
-	fwrite(&nWidth, sizeof(int), 1, f);
-	fwrite(&nHeight, sizeof(int), 1, f);
-	fwrite(m_Colours, sizeof(short), nWidth * nHeight, f);
-	fwrite(m_Glyphs, sizeof(short), nWidth * nHeight, f);
+	sSpriteHeader header = {};
+	memcpy(header.magic, SPRITE_MAGIC, 4);
+	header.nVersion = SPRITE_VERSION;
+	header.nFlags = SPRITE_CHECKSUM | (bCompact ? SPRITE_COMPACT : 0);
+	header.nWidth = nWidth;
+	header.nHeight = nHeight;
+	header.nCellOffset = sizeof(sSpriteHeader);
+	header.nChecksum = SpriteChecksum(data.data(), data.size());
+	header.nDataSize = (uint32_t) data.size();
+
+	fwrite(&header, sizeof(sSpriteHeader), 1, f);
+	fwrite(data.data(), sizeof(char), data.size(), f);
 
 	fclose(f);
 
@@ -87,8 +308,7 @@ bool Sprite::Save(std::wstring sFile) {
 }
 
 bool Sprite::Load(std::wstring sFile) {
-	delete[] m_Glyphs;
-	delete[] m_Colours;
+	Release();
 	nWidth = 0;
 	nHeight = 0;
 
@@ -97,15 +317,83 @@ bool Sprite::Load(std::wstring sFile) {
 	if (f == nullptr)
 		return false;
 
-	std::fread(&nWidth, sizeof(int), 1, f);
-	std::fread(&nHeight, sizeof(int), 1, f);
+	std::fseek(f, 0, SEEK_END);
+	long nSize = std::ftell(f);
+	std::fseek(f, 0, SEEK_SET);
 
-	Create(nWidth, nHeight);
+	std::vector<char> data(nSize > 0 ? nSize : 0);
+	size_t nRead = std::fread(data.data(), 1, data.size(), f);
+	std::fclose(f);
 
-	std::fread(m_Colours, sizeof(short), nWidth * nHeight, f);
-	std::fread(m_Glyphs, sizeof(short), nWidth * nHeight, f);
+	return nRead == data.size() && Parse(data.data(), data.size(), false);
+}
 
-	std::fclose(f);
+bool Sprite::Parse(const char* pData, size_t nSize, bool bInPlace) {
+	Release();
+	nWidth = 0;
+	nHeight = 0;
+
+	if (nSize >= sizeof(sSpriteHeader) && memcmp(pData, SPRITE_MAGIC, 4) == 0) {
+		const sSpriteHeader* pHeader = (const sSpriteHeader*) pData;
+		if (pHeader->nVersion != SPRITE_VERSION || pHeader->nWidth <= 0 || pHeader->nHeight <= 0 ||
+			pHeader->nCellOffset < sizeof(sSpriteHeader) || pHeader->nCellOffset % sizeof(sSpriteCell) != 0)
+			return false;
+
+		size_t nDataSize = SpriteDataSize(*pHeader);
+		if (pHeader->nCellOffset + nDataSize > nSize)
+			return false;
+
+		const char* pCellData = pData + pHeader->nCellOffset;
+		if ((pHeader->nFlags & SPRITE_CHECKSUM) && SpriteChecksum(pCellData, nDataSize) != pHeader->nChecksum)
+			return false;
+
+		if (pHeader->nFlags & SPRITE_COMPACT) {
+			std::unique_ptr<sSpriteSpans> pSpans(new sSpriteSpans());
+			if (!DecodeSpriteCells(pCellData, nDataSize, pHeader->nWidth, pHeader->nHeight, *pSpans))
+				return false;
+			nWidth = pHeader->nWidth;
+			nHeight = pHeader->nHeight;
+			m_pSpans = std::move(pSpans);
+			return true;
+		}
+
+		const CHAR_INFO* pCells = (const CHAR_INFO*) pCellData;
+		size_t nBytes = (size_t) pHeader->nWidth * pHeader->nHeight * sizeof(CHAR_INFO);
+		if (nDataSize < nBytes)
+			return false;
+
+		// Cells are used where they are unless the caller's buffer is going away
+		if (bInPlace && (uintptr_t) pCells % alignof(CHAR_INFO) == 0) {
+			nWidth = pHeader->nWidth;
+			nHeight = pHeader->nHeight;
+			m_Cells = const_cast<CHAR_INFO*>(pCells);
+			m_bOwned = false;
+		} else {
+			Create(pHeader->nWidth, pHeader->nHeight);
+			memcpy(m_Cells, pCells, nBytes);
+		}
+		return true;
+	}
+
+	// v1, all colours then all glyphs, always converted into a copy
+	int w = 0, h = 0;
+	if (nSize < 2 * sizeof(int))
+		return false;
+	memcpy(&w, pData, sizeof(int));
+	memcpy(&h, pData + sizeof(int), sizeof(int));
+	if (w <= 0 || h <= 0 || 2 * sizeof(int) + (size_t) w * h * 2 * sizeof(short) > nSize)
+		return false;
+
+	Create(w, h);
+	const char* pColours = pData + 2 * sizeof(int);
+	const char* pGlyphs = pColours + w * h * sizeof(short);
+	for (int i = 0; i < w * h; i++) {
+		short colour, glyph;
+		memcpy(&colour, pColours + i * sizeof(short), sizeof(short));
+		memcpy(&glyph, pGlyphs + i * sizeof(short), sizeof(short));
+		m_Cells[i].Char.UnicodeChar = glyph;
+		m_Cells[i].Attributes = colour;
+	}
 	return true;
 }
 
@@ -115,20 +403,32 @@ ConsoleGameEngine::ConsoleGameEngine() {
 
 	m_hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
 	m_hConsoleIn = GetStdHandle(STD_INPUT_HANDLE);
+	m_hOriginalConsole = m_hConsole;
+	m_bufScreen = nullptr;
+	m_clip = ScreenRect();
+
+	m_consoleInput = ConsoleInput(m_hConsoleIn);
+	m_pInputSource = &m_consoleInput;
+	m_bAtomActive = false;
+
+	m_pAssets = std::make_shared<AssetCache>();
 
 	std::memset(m_keyNewState, 0, 256 * sizeof(short));
 	std::memset(m_keyOldState, 0, 256 * sizeof(short));
 	std::memset(m_keys, 0, 256 * sizeof(sKeyState));
+	std::memset(m_mouse, 0, 5 * sizeof(sKeyState));
 	m_mousePosX = 0;
 	m_mousePosY = 0;
 
 	m_bEnableSound = false;
 
+	m_nRandomSeed = (unsigned int) std::chrono::system_clock::now().time_since_epoch().count();
+
 	m_sAppName = L"Default";
 }
 
 void ConsoleGameEngine::EnableSound() {
-	m_bEnableSound = true;
+	m_bEnableSound = !m_bHeadless;
 }
 
 int ConsoleGameEngine::ConstructConsole(int width, int height, int fontw, int fonth) {
@@ -210,37 +510,63 @@ int ConsoleGameEngine::ConstructConsole(int width, int height, int fontw, int fo
 	m_bufScreen = new CHAR_INFO[m_nScreenWidth * m_nScreenHeight];
 	memset(m_bufScreen, 0, sizeof(CHAR_INFO) * m_nScreenWidth * m_nScreenHeight);
 
-	SetConsoleCtrlHandler((PHANDLER_ROUTINE) CloseHandler, TRUE);
+	m_vecClips.clear();
+	m_clip = ScreenRect();
+	return 1;
+}
+
+int ConsoleGameEngine::ConstructHeadless(int width, int height) {
+	m_bHeadless = true;
+	m_bEnableSound = false;
+
+	m_nScreenWidth = width;
+	m_nScreenHeight = height;
+	m_rectWindow = {0, 0, (short) (m_nScreenWidth - 1), (short) (m_nScreenHeight - 1)};
+
+	// Allocate memory for screen buffer
+	m_bufScreen = new CHAR_INFO[m_nScreenWidth * m_nScreenHeight];
+	memset(m_bufScreen, 0, sizeof(CHAR_INFO) * m_nScreenWidth * m_nScreenHeight);
+
+	m_vecClips.clear();
+	m_clip = ScreenRect();
 	return 1;
 }
 
 void ConsoleGameEngine::Draw(int x, int y, short c, short col) {
-	if (x >= 0 && x < m_nScreenWidth && y >= 0 && y < m_nScreenHeight) {
+	if (x >= m_clip.x1 && x < m_clip.x2 && y >= m_clip.y1 && y < m_clip.y2) {
 		m_bufScreen[y * m_nScreenWidth + x].Char.UnicodeChar = c;
 		m_bufScreen[y * m_nScreenWidth + x].Attributes = col;
+		Cover(y, x, x + 1);
 	}
 }
 
 void ConsoleGameEngine::Fill(int x1, int y1, int x2, int y2, short c, short col) {
-	Clip(x1, y1);
-	Clip(x2, y2);
-	for (int x = x1; x < x2; x++)
-		for (int y = y1; y < y2; y++)
-			Draw(x, y, c, col);
+	FillIn(m_clip, x1, y1, x2, y2, c, col);
 }
 
 void ConsoleGameEngine::DrawString(int x, int y, std::wstring c, short col) {
-	for (size_t i = 0; i < c.size(); i++) {
+	if (y < m_clip.y1 || y >= m_clip.y2)
+		return;
+
+	int i1 = std::max(0, m_clip.x1 - x);
+	int i2 = std::min((int) c.size(), m_clip.x2 - x);
+	for (int i = i1; i < i2; i++) {
 		m_bufScreen[y * m_nScreenWidth + x + i].Char.UnicodeChar = c[i];
 		m_bufScreen[y * m_nScreenWidth + x + i].Attributes = col;
 	}
+	Cover(y, x + i1, x + i2);
 }
 
 void ConsoleGameEngine::DrawStringAlpha(int x, int y, std::wstring c, short col) {
-	for (size_t i = 0; i < c.size(); i++) {
+	if (y < m_clip.y1 || y >= m_clip.y2)
+		return;
+
+	int i2 = std::min((int) c.size(), m_clip.x2 - x);
+	for (int i = std::max(0, m_clip.x1 - x); i < i2; i++) {
 		if (c[i] != L' ') {
 			m_bufScreen[y * m_nScreenWidth + x + i].Char.UnicodeChar = c[i];
 			m_bufScreen[y * m_nScreenWidth + x + i].Attributes = col;
+			Cover(y, x + i, x + i + 1);
 		}
 	}
 }
@@ -252,48 +578,144 @@ void ConsoleGameEngine::Clip(int& x, int& y) {
 	if (y >= m_nScreenHeight) y = m_nScreenHeight;
 }
 
-void ConsoleGameEngine::DrawLine(int x1, int y1, int x2, int y2, short c, short col) {
-	int x, y, dx, dy, dx1, dy1, px, py, xe, ye, i;
-	dx = x2 - x1; dy = y2 - y1;
-	dx1 = abs(dx); dy1 = abs(dy);
-	px = 2 * dy1 - dx1;	py = 2 * dx1 - dy1;
-	if (dy1 <= dx1) {
-		if (dx >= 0) {
-			x = x1; y = y1; xe = x2;
-		} else {
-			x = x2; y = y2; xe = x1;
-		}
-
-		Draw(x, y, c, col);
+namespace {
+	// Smallest integer at least a / b, for b > 0
+	long long CeilDiv(long long a, long long b) {
+		return a >= 0 ? (a + b - 1) / b : -((-a) / b);
+	}
 
-		for (i = 0; x < xe; i++) {
-			x = x + 1;
-			if (px < 0)
-				px = px + 2 * dy1;
-			else {
-				if ((dx < 0 && dy < 0) || (dx > 0 && dy > 0)) y = y + 1; else y = y - 1;
-				px = px + 2 * (dy1 - dx1);
+	// Rows of an edge as FillTriangle() has always filled them, walked down
+	// from (xa, ya) to (xb, yb), ya <= yb. Span(y, x1, x2) gets the columns
+	// the edge passes through on every row from ya to yb
+	template<typename SPAN>
+	void WalkEdge(int xa, int ya, int xb, int yb, SPAN Span) {
+		int dx = abs(xb - xa);
+		int dy = yb - ya;
+		int sign = xb < xa ? -1 : 1;
+
+		// Steep edges step once per row, the others along x until the row ends
+		bool bSteep = dy > dx;
+		if (bSteep)
+			std::swap(dx, dy);
+
+		int e = dx >> 1;
+		int x = xa;
+		for (int y = ya; y < yb; y++) {
+			int xStart = x;
+			int xNext = 0;
+			if (bSteep) {
+				e += dy;
+				while (e >= dx) {
+					e -= dx;
+					xNext = sign;
+				}
+			} else {
+				for (;;) {
+					e += dy;
+					if (e >= dx) {
+						e -= dx;
+						break;
+					}
+					x += sign;
+				}
 			}
-			Draw(x, y, c, col);
+
+			Span(y, std::min(xStart, x), std::max(xStart, x));
+			if (!bSteep)
+				x += sign;
+			x += xNext;
 		}
+
+		// The last row runs on to the end point
+		Span(yb, std::min(x, xb), std::max(x, xb));
+	}
+}
+
+void ConsoleGameEngine::DrawLine(int x1, int y1, int x2, int y2, short c, short col) {
+	DrawLineIn(m_clip, x1, y1, x2, y2, c, col);
+}
+
+void ConsoleGameEngine::DrawLineIn(const sScreenRect& clip, int x1, int y1, int x2, int y2, short c, short col) {
+	int dx = x2 - x1;
+	int dy = y2 - y1;
+	int dx1 = abs(dx);
+	int dy1 = abs(dy);
+
+	// The line is walked along its major axis from its lower end, the minor
+	// axis moves in nStep. After k steps it has moved m(k) times, worked out
+	// in closed form below, which gives the steps on screen up front and
+	// the Bresenham state at the first of them
+	int nStep = ((dx < 0 && dy < 0) || (dx > 0 && dy > 0)) ? 1 : -1;
+	bool bAlongX = dy1 <= dx1;
+	int nMajor = bAlongX ? dx1 : dy1;
+	int nMinor = bAlongX ? dy1 : dx1;
+	int x, y;
+	if (bAlongX ? dx >= 0 : dy >= 0) {
+		x = x1; y = y1;
 	} else {
-		if (dy >= 0) {
-			x = x1; y = y1; ye = y2;
-		} else {
-			x = x2; y = y2; ye = y1;
-		}
+		x = x2; y = y2;
+	}
 
-		Draw(x, y, c, col);
+	// Along x a step moves when px >= 0, m(k) = floor((2k dy + dx) / 2dx).
+	// Along y only when py > 0, m(k) = floor((2k dx + dy - 1) / 2dy)
+	long long nBias = bAlongX ? nMajor : nMajor - 1;
+	auto Moves = [&] (long long k) {
+		return nMajor == 0 ? 0 : (2 * k * nMinor + nBias) / (2 * (long long) nMajor);
+	};
+
+	// First step k with m(k) >= m, and first one with m(k) > m
+	long long nNever = (long long) nMajor + 1;
+	auto FirstAtLeast = [&] (long long m) {
+		if (m <= 0)
+			return 0LL;
+		return nMinor == 0 ? nNever : CeilDiv(2 * m * nMajor - nBias, 2 * (long long) nMinor);
+	};
+	auto FirstAbove = [&] (long long m) {
+		if (m < 0)
+			return 0LL;
+		return nMinor == 0 ? nNever : CeilDiv(2 * (m + 1) * nMajor - nBias, 2 * (long long) nMinor);
+	};
+
+	// Steps inside the clip along the major axis
+	int nMajorPos = bAlongX ? x : y;
+	int nMinorPos = bAlongX ? y : x;
+	long long k1 = std::max(0LL, (long long) (bAlongX ? clip.x1 : clip.y1) - nMajorPos);
+	long long k2 = std::min((long long) nMajor, (long long) (bAlongX ? clip.x2 : clip.y2) - 1 - nMajorPos);
+
+	// and across it, m(k) only grows
+	long long nMinorLow = (bAlongX ? clip.y1 : clip.x1) - (long long) nMinorPos;
+	long long nMinorHigh = (bAlongX ? clip.y2 : clip.x2) - 1 - (long long) nMinorPos;
+	if (nStep < 0) {
+		long long t = nMinorLow;
+		nMinorLow = -nMinorHigh;
+		nMinorHigh = -t;
+	}
+	k1 = std::max(k1, FirstAtLeast(nMinorLow));
+	k2 = std::min(k2, FirstAbove(nMinorHigh) - 1);
+	if (k1 > k2)
+		return;
 
-		for (i = 0; y < ye; i++) {
-			y = y + 1;
-			if (py <= 0)
-				py = py + 2 * dx1;
-			else {
-				if ((dx < 0 && dy < 0) || (dx > 0 && dy > 0)) x = x + 1; else x = x - 1;
-				py = py + 2 * (dx1 - dy1);
-			}
-			Draw(x, y, c, col);
+	long long m = Moves(k1);
+	int p = (int) (2 * (long long) nMinor - nMajor + 2 * k1 * nMinor - 2 * m * nMajor);
+	int a = nMajorPos + (int) k1;
+	int b = nMinorPos + nStep * (int) m;
+	for (long long k = k1; ; k++) {
+		CHAR_INFO& cell = bAlongX ? m_bufScreen[b * m_nScreenWidth + a] : m_bufScreen[a * m_nScreenWidth + b];
+		cell.Char.UnicodeChar = c;
+		cell.Attributes = col;
+		if (bAlongX)
+			Cover(b, a, a + 1);
+		else
+			Cover(a, b, b + 1);
+		if (k == k2)
+			break;
+
+		a++;
+		if (bAlongX ? p < 0 : p <= 0) {
+			p += 2 * nMinor;
+		} else {
+			b += nStep;
+			p += 2 * (nMinor - nMajor);
 		}
 	}
 }
@@ -305,133 +727,139 @@ void ConsoleGameEngine::DrawTriangle(int x1, int y1, int x2, int y2, int x3, int
 }
 
 void ConsoleGameEngine::FillTriangle(int x1, int y1, int x2, int y2, int x3, int y3, short c, short col) {
-	auto SWAP = [] (int& x, int& y) { int t = x; x = y; y = t; };
-	auto drawline = [&] (int sx, int ex, int ny) { for (int i = sx; i <= ex; i++) Draw(i, ny, c, col); };
-
-	int t1x, t2x, y, minx, maxx, t1xp, t2xp;
-	bool changed1 = false;
-	bool changed2 = false;
-	int signx1, signx2, dx1, dy1, dx2, dy2;
-	int e1, e2;
 	// Sort vertices
-	if (y1 > y2) { SWAP(y1, y2); SWAP(x1, x2); }
-	if (y1 > y3) { SWAP(y1, y3); SWAP(x1, x3); }
-	if (y2 > y3) { SWAP(y2, y3); SWAP(x2, x3); }
-
-	t1x = t2x = x1; y = y1;   // Starting points
-	dx1 = (int) (x2 - x1); if (dx1 < 0) { dx1 = -dx1; signx1 = -1; } else signx1 = 1;
-	dy1 = (int) (y2 - y1);
-
-	dx2 = (int) (x3 - x1); if (dx2 < 0) { dx2 = -dx2; signx2 = -1; } else signx2 = 1;
-	dy2 = (int) (y3 - y1);
-
-	if (dy1 > dx1) {   // swap values
-		SWAP(dx1, dy1);
-		changed1 = true;
-	}
-	if (dy2 > dx2) {   // swap values
-		SWAP(dy2, dx2);
-		changed2 = true;
-	}
-
-	e2 = (int) (dx2 >> 1);
-	// Flat top, just process the second half
-	if (y1 == y2) goto next;
-	e1 = (int) (dx1 >> 1);
-
-	for (int i = 0; i < dx1;) {
-		t1xp = 0; t2xp = 0;
-		if (t1x < t2x) { minx = t1x; maxx = t2x; } else { minx = t2x; maxx = t1x; }
-		// process first line until y value is about to change
-		while (i < dx1) {
-			i++;
-			e1 += dy1;
-			while (e1 >= dx1) {
-				e1 -= dx1;
-				if (changed1) t1xp = signx1;//t1x += signx1;
-				else          goto next1;
-			}
-			if (changed1) break;
-			else t1x += signx1;
-		}
-		// Move line
-	next1:
-		// process second line until y value is about to change
-		while (1) {
-			e2 += dy2;
-			while (e2 >= dx2) {
-				e2 -= dx2;
-				if (changed2) t2xp = signx2;//t2x += signx2;
-				else          goto next2;
-			}
-			if (changed2)     break;
-			else              t2x += signx2;
-		}
-	next2:
-		if (minx > t1x) minx = t1x; if (minx > t2x) minx = t2x;
-		if (maxx < t1x) maxx = t1x; if (maxx < t2x) maxx = t2x;
-		drawline(minx, maxx, y);    // Draw line from min to max points found on the y
-		// Now increase y
-		if (!changed1) t1x += signx1;
-		t1x += t1xp;
-		if (!changed2) t2x += signx2;
-		t2x += t2xp;
-		y += 1;
-		if (y == y2) break;
-
-	}
-next:
-	// Second half
-	dx1 = (int) (x3 - x2); if (dx1 < 0) { dx1 = -dx1; signx1 = -1; } else signx1 = 1;
-	dy1 = (int) (y3 - y2);
-	t1x = x2;
-
-	if (dy1 > dx1) {   // swap values
-		SWAP(dy1, dx1);
-		changed1 = true;
-	} else changed1 = false;
-
-	e1 = (int) (dx1 >> 1);
-
-	for (int i = 0; i <= dx1; i++) {
-		t1xp = 0; t2xp = 0;
-		if (t1x < t2x) { minx = t1x; maxx = t2x; } else { minx = t2x; maxx = t1x; }
-		// process first line until y value is about to change
-		while (i < dx1) {
-			e1 += dy1;
-			while (e1 >= dx1) {
-				e1 -= dx1;
-				if (changed1) { t1xp = signx1; break; }//t1x += signx1;
-				else          goto next3;
-			}
-			if (changed1) break;
-			else   	   	  t1x += signx1;
-			if (i < dx1) i++;
-		}
-	next3:
-		// process second line until y value is about to change
-		while (t2x != x3) {
-			e2 += dy2;
-			while (e2 >= dx2) {
-				e2 -= dx2;
-				if (changed2) t2xp = signx2;
-				else          goto next4;
-			}
-			if (changed2)     break;
-			else              t2x += signx2;
+	if (y1 > y2) { std::swap(y1, y2); std::swap(x1, x2); }
+	if (y1 > y3) { std::swap(y1, y3); std::swap(x1, x3); }
+	if (y2 > y3) { std::swap(y2, y3); std::swap(x2, x3); }
+
+	sScreenRect clip = m_clip;
+	int ry1 = std::max(y1, clip.y1);
+	int ry2 = std::min(y3, clip.y2 - 1);
+	if (ry1 > ry2)
+		return;
+
+	// Every row is filled from the leftmost to the rightmost column any edge
+	// passes through on it. The upper short edge leaves its last row to the
+	// lower one
+	m_vecRowSpans.assign(ry2 - ry1 + 1, std::make_pair(INT_MAX, INT_MIN));
+	auto Span = [&] (int y, int sx, int ex) {
+		if (y < ry1 || y > ry2)
+			return;
+		std::pair<int, int>& span = m_vecRowSpans[y - ry1];
+		span.first = std::min(span.first, sx);
+		span.second = std::max(span.second, ex);
+	};
+	WalkEdge(x1, y1, x3, y3, Span);
+	WalkEdge(x1, y1, x2, y2, [&] (int y, int sx, int ex) {
+		if (y < y2 || y1 == y2)
+			Span(y, sx, ex);
+	});
+	WalkEdge(x2, y2, x3, y3, Span);
+
+	for (int y = ry1; y <= ry2; y++)
+		FillSpanIn(clip, y, m_vecRowSpans[y - ry1].first, m_vecRowSpans[y - ry1].second, c, col);
+}
+
+void ConsoleGameEngine::FillPolygon(const std::pair<int, int>* pPoints, int nPoints, short c, short col) {
+	if (nPoints <= 0)
+		return;
+
+	// Which part of a flat bottom FillTriangle() fills depends on the order
+	// of its vertices, only it can give the same cells
+	if (nPoints == 3) {
+		FillTriangle(pPoints[0].first, pPoints[0].second, pPoints[1].first, pPoints[1].second,
+					 pPoints[2].first, pPoints[2].second, c, col);
+		return;
+	}
+
+	sScreenRect clip = m_clip;
+	int ymin = INT_MAX;
+	int ymax = INT_MIN;
+	for (int i = 0; i < nPoints; i++) {
+		ymin = std::min(ymin, pPoints[i].second);
+		ymax = std::max(ymax, pPoints[i].second);
+	}
+	int ry1 = std::max(ymin, clip.y1);
+	int ry2 = std::min(ymax, clip.y2 - 1);
+	if (ry1 > ry2)
+		return;
+
+	m_vecSpans.clear();
+	m_vecCrossings.clear();
+	for (int i = 0; i < nPoints; i++) {
+		std::pair<int, int> a = pPoints[i];
+		std::pair<int, int> b = pPoints[i + 1 < nPoints ? i + 1 : 0];
+
+		// Edges are walked downwards like FillTriangle() does. An edge gives
+		// its last row to the next one when the outline carries on down
+		bool bDown = a.second <= b.second;
+		std::pair<int, int> top = bDown ? a : b;
+		std::pair<int, int> bottom = bDown ? b : a;
+		const std::pair<int, int>& beyond = bDown ? pPoints[(i + 2) % nPoints] : pPoints[(i + nPoints - 1) % nPoints];
+		int yLast = top.second < bottom.second && beyond.second > bottom.second ? bottom.second - 1 : bottom.second;
+
+		WalkEdge(top.first, top.second, bottom.first, bottom.second, [&] (int y, int sx, int ex) {
+			if (y >= ry1 && y <= ry2 && y <= yLast)
+				m_vecSpans.push_back({y, sx, ex});
+		});
+
+		// Where the edge crosses each row, for the inside of the outline.
+		// Integer ratios come out of the division exact enough to round
+		for (int y = std::max(top.second, ry1); y < std::min(bottom.second, ry2 + 1); y++) {
+			double x = top.first + (double) (y - top.second) * (bottom.first - top.first) / (bottom.second - top.second);
+			m_vecCrossings.push_back(std::make_pair(y, x));
+		}
+	}
+
+	// Inside is between every other pair of crossings along a row
+	std::sort(m_vecCrossings.begin(), m_vecCrossings.end());
+	for (size_t i = 0; i < m_vecCrossings.size();) {
+		size_t nRowEnd = i;
+		while (nRowEnd < m_vecCrossings.size() && m_vecCrossings[nRowEnd].first == m_vecCrossings[i].first)
+			nRowEnd++;
+
+		for (; i + 1 < nRowEnd; i += 2) {
+			int sx = (int) ceil(m_vecCrossings[i].second);
+			int ex = (int) floor(m_vecCrossings[i + 1].second);
+			if (sx <= ex)
+				m_vecSpans.push_back({m_vecCrossings[i].first, sx, ex});
 		}
-	next4:
+		i = nRowEnd;
+	}
+
+	// Overlapping and touching spans of a row are filled as one
+	std::sort(m_vecSpans.begin(), m_vecSpans.end(), [] (const sSpan& a, const sSpan& b) {
+		return a.y != b.y ? a.y < b.y : a.x1 < b.x1;
+	});
+	for (size_t i = 0; i < m_vecSpans.size();) {
+		sSpan span = m_vecSpans[i++];
+		while (i < m_vecSpans.size() && m_vecSpans[i].y == span.y && m_vecSpans[i].x1 <= span.x2 + 1)
+			span.x2 = std::max(span.x2, m_vecSpans[i++].x2);
+		FillSpanIn(clip, span.y, span.x1, span.x2, c, col);
+	}
+}
+
+void ConsoleGameEngine::FillPolygon(const std::vector<std::pair<int, int>>& vecPoints, short c, short col) {
+	FillPolygon(vecPoints.data(), (int) vecPoints.size(), c, col);
+}
 
-		if (minx > t1x) minx = t1x; if (minx > t2x) minx = t2x;
-		if (maxx < t1x) maxx = t1x; if (maxx < t2x) maxx = t2x;
-		drawline(minx, maxx, y);
-		if (!changed1) t1x += signx1;
-		t1x += t1xp;
-		if (!changed2) t2x += signx2;
-		t2x += t2xp;
-		y += 1;
-		if (y > y3) return;
+void ConsoleGameEngine::FillSpanIn(const sScreenRect& clip, int y, int x1, int x2, short c, short col) {
+	if (y < clip.y1 || y >= clip.y2)
+		return;
+
+	x1 = std::max(x1, clip.x1);
+	x2 = std::min(x2, clip.x2 - 1);
+	CHAR_INFO* pRow = m_bufScreen + y * m_nScreenWidth;
+	for (int x = x1; x <= x2; x++) {
+		pRow[x].Char.UnicodeChar = c;
+		pRow[x].Attributes = col;
 	}
+	Cover(y, x1, x2 + 1);
+}
+
+void ConsoleGameEngine::Cover(int y, int x1, int x2) {
+	if (m_pCoverage != nullptr && x1 < x2)
+		std::fill(m_pCoverage + y * m_nScreenWidth + x1, m_pCoverage + y * m_nScreenWidth + x2, 0xFFFFFFFF);
 }
 
 void ConsoleGameEngine::DrawCircle(int xc, int yc, int r, short c, short col) {
@@ -440,16 +868,30 @@ void ConsoleGameEngine::DrawCircle(int xc, int yc, int r, short c, short col) {
 	int p = 3 - 2 * r;
 	if (!r) return;
 
+	// Off the clip altogether, or inside it so no cell needs testing
+	if (xc + r < m_clip.x1 || xc - r >= m_clip.x2 || yc + r < m_clip.y1 || yc - r >= m_clip.y2)
+		return;
+	bool bInside = xc - r >= m_clip.x1 && xc + r < m_clip.x2 && yc - r >= m_clip.y1 && yc + r < m_clip.y2;
+	auto plot = [&] (int px, int py) {
+		if (bInside) {
+			m_bufScreen[py * m_nScreenWidth + px].Char.UnicodeChar = c;
+			m_bufScreen[py * m_nScreenWidth + px].Attributes = col;
+			Cover(py, px, px + 1);
+		} else {
+			Draw(px, py, c, col);
+		}
+	};
+
 	while (y >= x) // only formulate 1/8 of circle
 	{
-		Draw(xc - x, yc - y, c, col);//upper left left
-		Draw(xc - y, yc - x, c, col);//upper upper left
-		Draw(xc + y, yc - x, c, col);//upper upper right
-		Draw(xc + x, yc - y, c, col);//upper right right
-		Draw(xc - x, yc + y, c, col);//lower left left
-		Draw(xc - y, yc + x, c, col);//lower lower left
-		Draw(xc + y, yc + x, c, col);//lower lower right
-		Draw(xc + x, yc + y, c, col);//lower right right
+		plot(xc - x, yc - y);//upper left left
+		plot(xc - y, yc - x);//upper upper left
+		plot(xc + y, yc - x);//upper upper right
+		plot(xc + x, yc - y);//upper right right
+		plot(xc - x, yc + y);//lower left left
+		plot(xc - y, yc + x);//lower lower left
+		plot(xc + y, yc + x);//lower lower right
+		plot(xc + x, yc + y);//lower right right
 		if (p < 0) p += 4 * x++ + 6;
 		else p += 4 * (x++ - y--) + 10;
 	}
@@ -462,9 +904,11 @@ void ConsoleGameEngine::FillCircle(int xc, int yc, int r, short c, short col) {
 	int p = 3 - 2 * r;
 	if (!r) return;
 
+	if (xc + r < m_clip.x1 || xc - r >= m_clip.x2 || yc + r < m_clip.y1 || yc - r >= m_clip.y2)
+		return;
+
 	auto drawline = [&] (int sx, int ex, int ny) {
-		for (int i = sx; i <= ex; i++)
-			Draw(i, ny, c, col);
+		FillSpanIn(m_clip, ny, sx, ex, c, col);
 		};
 
 	while (y >= x) {
@@ -478,77 +922,534 @@ void ConsoleGameEngine::FillCircle(int xc, int yc, int r, short c, short col) {
 	}
 };
 
-void ConsoleGameEngine::DrawSprite(int x, int y, Sprite* sprite) {
+void ConsoleGameEngine::DrawSprite(int x, int y, const Sprite* sprite) {
 	if (sprite == nullptr)
 		return;
 
-	for (int i = 0; i < sprite->nWidth; i++) {
-		for (int j = 0; j < sprite->nHeight; j++) {
-			if (sprite->GetGlyph(i, j) != L' ')
-				Draw(x + i, y + j, sprite->GetGlyph(i, j), sprite->GetColour(i, j));
+	// The part of the sprite inside the clip
+	int i1 = std::max(0, m_clip.x1 - x);
+	int i2 = std::min(sprite->nWidth, m_clip.x2 - x);
+	int j1 = std::max(0, m_clip.y1 - y);
+	int j2 = std::min(sprite->nHeight, m_clip.y2 - y);
+	if (i1 >= i2 || j1 >= j2)
+		return;
+
+	// Compact sprites only hold their drawable cells, walk those
+	const sSpriteSpans* pSpans = sprite->Spans();
+	if (pSpans != nullptr) {
+		for (int j = j1; j < j2; j++) {
+			CHAR_INFO* pRow = m_bufScreen + (y + j) * m_nScreenWidth + x;
+			for (int s = pSpans->rowSpans[j]; s < pSpans->rowSpans[j + 1]; s++) {
+				const sSpriteSpan& span = pSpans->spans[s];
+				const uint8_t* pIndex = pSpans->indices.data() + span.nIndex;
+				int k1 = std::max(0, i1 - span.x);
+				int k2 = std::min((int) span.nLength, i2 - span.x);
+				for (int k = k1; k < k2; k++) {
+					const sSpriteCell& cell = pSpans->palette[pIndex[k]];
+					pRow[span.x + k].Char.UnicodeChar = cell.glyph;
+					pRow[span.x + k].Attributes = cell.colour;
+				}
+				Cover(y + j, x + span.x + k1, x + span.x + k2);
+			}
+		}
+		return;
+	}
+
+	// Fully inside and the size of a built-in sprite, use the unrolled blit.
+	// It cannot tell a layer which cells it drew
+	if (i1 == 0 && j1 == 0 && i2 == sprite->nWidth && j2 == sprite->nHeight && m_pCoverage == nullptr) {
+		FIXED_BLIT pBlit = FindFixedBlit(sprite->nWidth, sprite->nHeight);
+		if (pBlit != nullptr) {
+			pBlit(m_bufScreen + y * m_nScreenWidth + x, m_nScreenWidth, sprite->Cells());
+			return;
+		}
+	}
+
+	for (int j = j1; j < j2; j++) {
+		const CHAR_INFO* pSrc = sprite->Cells() + j * sprite->nWidth;
+		CHAR_INFO* pDst = m_bufScreen + (y + j) * m_nScreenWidth + x;
+		for (int i = i1; i < i2; i++) {
+			if (pSrc[i].Char.UnicodeChar != L' ') {
+				pDst[i] = pSrc[i];
+				Cover(y + j, x + i, x + i + 1);
+			}
 		}
 	}
 }
 
-void ConsoleGameEngine::DrawPartialSprite(int x, int y, Sprite* sprite, int ox, int oy, int w, int h) {
+void ConsoleGameEngine::DrawPartialSprite(int x, int y, const Sprite* sprite, int ox, int oy, int w, int h) {
 	if (sprite == nullptr)
 		return;
 
-	for (int i = 0; i < w; i++) {
-		for (int j = 0; j < h; j++) {
-			if (sprite->GetGlyph(i + ox, j + oy) != L' ')
-				Draw(x + i, y + j, sprite->GetGlyph(i + ox, j + oy), sprite->GetColour(i + ox, j + oy));
+	int i2 = std::min(w, m_clip.x2 - x);
+	int j2 = std::min(h, m_clip.y2 - y);
+	for (int i = std::max(0, m_clip.x1 - x); i < i2; i++) {
+		for (int j = std::max(0, m_clip.y1 - y); j < j2; j++) {
+			short glyph = sprite->GetGlyph(i + ox, j + oy);
+			if (glyph != L' ') {
+				m_bufScreen[(y + j) * m_nScreenWidth + x + i].Char.UnicodeChar = glyph;
+				m_bufScreen[(y + j) * m_nScreenWidth + x + i].Attributes = sprite->GetColour(i + ox, j + oy);
+				Cover(y + j, x + i, x + i + 1);
+			}
 		}
 	}
 }
 
-void ConsoleGameEngine::DrawWireFrameModel(const std::vector<std::pair<float, float>>& vecModelCoordinates, float x, float y, float r, float s, short col, short c) {
-	// pair.first = x coordinate
-	// pair.second = y coordinate
+void ConsoleGameEngine::DrawSpriteScaled(int x, int y, int nWidth, int nHeight, const Sprite* sprite) {
+	DrawSpriteScaledIn(m_clip, x, y, nWidth, nHeight, sprite);
+}
 
-	// Create translated model vector of coordinate pairs
-	std::vector<std::pair<float, float>> vecTransformedCoordinates;
-	int verts = vecModelCoordinates.size();
-	vecTransformedCoordinates.resize(verts);
+void ConsoleGameEngine::DrawSpriteTransformed(int x, int y, const Sprite* sprite, float fAngle, float fScale, bool bMirror) {
+	if (sprite == nullptr)
+		return;
 
-	// Rotate
-	for (int i = 0; i < verts; i++) {
-		vecTransformedCoordinates[i].first = vecModelCoordinates[i].first * cosf(r) - vecModelCoordinates[i].second * sinf(r);
-		vecTransformedCoordinates[i].second = vecModelCoordinates[i].first * sinf(r) + vecModelCoordinates[i].second * cosf(r);
+	// Whole turns are dropped first, so the step stays small
+	const float TWO_PI = 6.28318530718f;
+	float fSteps = fmodf(fAngle, TWO_PI) * (SPRITE_ANGLE_STEPS / TWO_PI);
+	float fStep = floorf(fSteps + 0.5f);
+	if (fScale == 1.0f && fabsf(fSteps - fStep) < 0.001f) {
+		int nStep = ((int) fStep % SPRITE_ANGLE_STEPS + SPRITE_ANGLE_STEPS) % SPRITE_ANGLE_STEPS;
+		const sSpriteVariant* pVariant = SpriteVariant(sprite, nStep, bMirror);
+		DrawCellsMasked(x + pVariant->nOffsetX, y + pVariant->nOffsetY, pVariant->nWidth, pVariant->nHeight,
+						pVariant->cells.data(), pVariant->mask.data(), pVariant->nWidth);
+		return;
 	}
 
-	// Scale
-	for (int i = 0; i < verts; i++) {
-		vecTransformedCoordinates[i].first = vecTransformedCoordinates[i].first * s;
-		vecTransformedCoordinates[i].second = vecTransformedCoordinates[i].second * s;
+	sScreenRect bounds = TransformedSpriteBounds(x, y, sprite, fAngle, fScale);
+	bounds.x1 = std::max(bounds.x1, m_clip.x1);
+	bounds.y1 = std::max(bounds.y1, m_clip.y1);
+	bounds.x2 = std::min(bounds.x2, m_clip.x2);
+	bounds.y2 = std::min(bounds.y2, m_clip.y2);
+	DrawTransformedSprite(sprite, x, y, fAngle, fScale, bMirror, bounds, m_bufScreen, 0, 0, m_nScreenWidth, m_pCoverage);
+}
+
+void ConsoleGameEngine::PrepareSpriteVariants(const Sprite* sprite) {
+	if (SpriteVariant(sprite, 0, false) != nullptr)
+		m_pVariants->Prepare(sprite);
+}
+
+void ConsoleGameEngine::DrawCells(int x, int y, int nWidth, int nHeight, const CHAR_INFO* pCells, int nStride) {
+	int x1 = std::max(0, m_clip.x1 - x);
+	int x2 = std::min(nWidth, m_clip.x2 - x);
+	int y1 = std::max(0, m_clip.y1 - y);
+	int y2 = std::min(nHeight, m_clip.y2 - y);
+	if (x1 >= x2)
+		return;
+
+	for (int j = y1; j < y2; j++) {
+		memcpy(m_bufScreen + (y + j) * m_nScreenWidth + x + x1, pCells + j * nStride + x1, (x2 - x1) * sizeof(CHAR_INFO));
+		Cover(y + j, x + x1, x + x2);
 	}
+}
 
-	// Translate
-	for (int i = 0; i < verts; i++) {
-		vecTransformedCoordinates[i].first = vecTransformedCoordinates[i].first + x;
-		vecTransformedCoordinates[i].second = vecTransformedCoordinates[i].second + y;
+void ConsoleGameEngine::DrawCellsMasked(int x, int y, int nWidth, int nHeight, const CHAR_INFO* pCells, const uint32_t* pMask, int nStride) {
+	DrawCellsMaskedIn(m_clip, x, y, nWidth, nHeight, pCells, pMask, nStride);
+}
+
+void ConsoleGameEngine::DrawSpriteInstances(const Sprite* sprite, const sSpriteInstance* pInstances, int nInstances) {
+	if (sprite == nullptr || nInstances == 0)
+		return;
+
+	if (AtlasRegion(sprite) == nullptr) {
+		for (int i = 0; i < nInstances; i++)
+			DrawSprite(pInstances[i].x, pInstances[i].y, sprite);
+		return;
 	}
 
-	// Draw Closed Polygon
-	for (int i = 0; i < verts + 1; i++) {
-		int j = (i + 1);
-		DrawLine((int) vecTransformedCoordinates[i % verts].first, (int) vecTransformedCoordinates[i % verts].second,
-				 (int) vecTransformedCoordinates[j % verts].first, (int) vecTransformedCoordinates[j % verts].second, c, col);
+	DrawSpriteInstancesIn(m_clip, sprite, pInstances, nInstances);
+}
+
+void ConsoleGameEngine::PrepareSprite(const Sprite* sprite) {
+	if (sprite != nullptr)
+		AtlasRegion(sprite);
+}
+
+bool ConsoleGameEngine::AtlasCells(const Sprite* sprite, sMaskedCells& cells) const {
+	const sAtlasRegion* pRegion = m_pAtlas != nullptr ? m_pAtlas->Find(sprite) : nullptr;
+	if (pRegion == nullptr)
+		return false;
+
+	int nOffset = pRegion->y * m_pAtlas->Width() + pRegion->x;
+	cells = {pRegion->nWidth, pRegion->nHeight, m_pAtlas->Cells() + nOffset, m_pAtlas->Mask() + nOffset, m_pAtlas->Width()};
+	return true;
+}
+
+void ConsoleGameEngine::FillIn(const sScreenRect& clip, int x1, int y1, int x2, int y2, short c, short col) {
+	x1 = std::max(x1, clip.x1);
+	y1 = std::max(y1, clip.y1);
+	x2 = std::min(x2, clip.x2);
+	y2 = std::min(y2, clip.y2);
+
+	for (int y = y1; y < y2; y++) {
+		CHAR_INFO* pRow = m_bufScreen + y * m_nScreenWidth;
+		for (int x = x1; x < x2; x++) {
+			pRow[x].Char.UnicodeChar = c;
+			pRow[x].Attributes = col;
+		}
+		Cover(y, x1, x2);
+	}
+}
+
+void ConsoleGameEngine::DrawCellsMaskedIn(const sScreenRect& clip, int x, int y, int nWidth, int nHeight, const CHAR_INFO* pCells, const uint32_t* pMask, int nStride) {
+	int x1 = std::max(0, clip.x1 - x);
+	int x2 = std::min(nWidth, clip.x2 - x);
+	int y1 = std::max(0, clip.y1 - y);
+	int y2 = std::min(nHeight, clip.y2 - y);
+
+	// A cell is as wide as a uint32_t, blend whole cells through the mask
+	for (int j = y1; j < y2; j++) {
+		uint32_t* pDst = (uint32_t*) (m_bufScreen + (y + j) * m_nScreenWidth + x);
+		const uint32_t* pSrc = (const uint32_t*) (pCells + j * nStride);
+		const uint32_t* pRowMask = pMask + j * nStride;
+		for (int i = x1; i < x2; i++)
+			pDst[i] = (pSrc[i] & pRowMask[i]) | (pDst[i] & ~pRowMask[i]);
+
+		if (m_pCoverage != nullptr) {
+			uint32_t* pCoverage = m_pCoverage + (y + j) * m_nScreenWidth + x;
+			for (int i = x1; i < x2; i++)
+				pCoverage[i] |= pRowMask[i];
+		}
+	}
+}
+
+void ConsoleGameEngine::DrawSpriteIn(const sScreenRect& clip, int x, int y, const Sprite* sprite) {
+	if (sprite == nullptr)
+		return;
+
+	int x1 = std::max(0, clip.x1 - x);
+	int x2 = std::min(sprite->nWidth, clip.x2 - x);
+	int y1 = std::max(0, clip.y1 - y);
+	int y2 = std::min(sprite->nHeight, clip.y2 - y);
+	for (int j = y1; j < y2; j++) {
+		for (int i = x1; i < x2; i++) {
+			short c = sprite->GetGlyph(i, j);
+			if (c == L' ')
+				continue;
+
+			CHAR_INFO& cell = m_bufScreen[(y + j) * m_nScreenWidth + x + i];
+			cell.Char.UnicodeChar = c;
+			cell.Attributes = sprite->GetColour(i, j);
+			Cover(y + j, x + i, x + i + 1);
+		}
+	}
+}
+
+void ConsoleGameEngine::DrawSpriteInstancesIn(const sScreenRect& clip, const Sprite* sprite, const sSpriteInstance* pInstances, int nInstances) {
+	if (sprite == nullptr || nInstances == 0)
+		return;
+
+	// Not in the atlas, too wide for it or never prepared, go cell by cell
+	sMaskedCells cells;
+	if (!AtlasCells(sprite, cells)) {
+		for (int i = 0; i < nInstances; i++)
+			DrawSpriteIn(clip, pInstances[i].x, pInstances[i].y, sprite);
+		return;
+	}
+
+	for (int i = 0; i < nInstances; i++)
+		DrawCellsMaskedIn(clip, pInstances[i].x, pInstances[i].y, cells.nWidth, cells.nHeight, cells.pCells, cells.pMask, cells.nStride);
+}
+
+void ConsoleGameEngine::DrawSpriteScaledIn(const sScreenRect& clip, int x, int y, int nWidth, int nHeight, const Sprite* sprite) {
+	if (sprite == nullptr || nWidth <= 0 || nHeight <= 0)
+		return;
+
+	int i1 = std::max(0, clip.x1 - x);
+	int i2 = std::min(nWidth, clip.x2 - x);
+	if (i1 >= i2)
+		return;
+
+	// Sampled a piece of a row at a time, blanks are left out. Sampling
+	// reads the row above y * nHeight, hence the extra row
+	CHAR_INFO cells[256];
+	float du = 1.0f / nWidth;
+	float fRowOffset = 1.0f / sprite->nHeight;
+	for (int j = std::max(0, clip.y1 - y); j < std::min(nHeight, clip.y2 - y); j++) {
+		float v = (j + 0.5f) / nHeight + fRowOffset;
+		CHAR_INFO* pRow = m_bufScreen + (y + j) * m_nScreenWidth + x;
+		for (int i = i1; i < i2; i += 256) {
+			int n = std::min(256, i2 - i);
+			sprite->SampleSpan((i + 0.5f) * du, v, du, 0.0f, n, cells);
+			for (int k = 0; k < n; k++) {
+				if (cells[k].Char.UnicodeChar != L' ') {
+					pRow[i + k] = cells[k];
+					Cover(y + j, x + i + k, x + i + k + 1);
+				}
+			}
+		}
+	}
+}
+
+sScreenRect ConsoleGameEngine::ScreenRect() const {
+	return {0, 0, m_nScreenWidth, m_nScreenHeight};
+}
+
+void ConsoleGameEngine::PushClip(int x1, int y1, int x2, int y2) {
+	m_vecClips.push_back(m_clip);
+
+	// Only ever narrows, an empty clip draws nothing
+	m_clip.x1 = std::min(std::max(x1, m_clip.x1), m_clip.x2);
+	m_clip.y1 = std::min(std::max(y1, m_clip.y1), m_clip.y2);
+	m_clip.x2 = std::max(std::min(x2, m_clip.x2), m_clip.x1);
+	m_clip.y2 = std::max(std::min(y2, m_clip.y2), m_clip.y1);
+}
+
+void ConsoleGameEngine::PopClip() {
+	if (m_vecClips.empty())
+		return;
+
+	m_clip = m_vecClips.back();
+	m_vecClips.pop_back();
+}
+
+sScreenRect ConsoleGameEngine::ClipRect() const {
+	return m_clip;
+}
+
+ScreenLayer& ConsoleGameEngine::GetLayer(const std::wstring& sName) {
+	std::unique_ptr<ScreenLayer>& pLayer = m_mapLayers[sName];
+	if (pLayer == nullptr)
+		pLayer.reset(new ScreenLayer(sName));
+	return *pLayer;
+}
+
+bool ConsoleGameEngine::BeginLayer(ScreenLayer& layer) {
+	if (layer.m_nWidth != m_nScreenWidth || layer.m_nHeight != m_nScreenHeight)
+		layer.Invalidate();
+	if (!layer.IsDirty() || m_pDrawingLayer != nullptr)
+		return false;
+
+	// Every draw call writes m_bufScreen, point it at the layer meanwhile.
+	// What they draw goes in the coverage, whatever the cells hold
+	layer.Reset(m_nScreenWidth, m_nScreenHeight);
+	m_pDrawingLayer = &layer;
+	m_bufSavedScreen = m_bufScreen;
+	m_bufScreen = layer.m_cells.data();
+	m_pCoverage = layer.m_coverage.data();
+	return true;
+}
+
+void ConsoleGameEngine::EndLayer() {
+	if (m_pDrawingLayer == nullptr)
+		return;
+
+	m_bufScreen = m_bufSavedScreen;
+	m_bufSavedScreen = nullptr;
+	m_pCoverage = nullptr;
+	m_pDrawingLayer->Seal();
+	m_pDrawingLayer = nullptr;
+}
+
+void ConsoleGameEngine::DrawLayer(const ScreenLayer& layer) {
+	if (layer.IsDirty())
+		return;
+
+	for (int y = m_clip.y1; y < std::min(m_clip.y2, layer.m_nHeight); y++) {
+		const CHAR_INFO* pSrc = layer.m_cells.data() + y * layer.m_nWidth;
+		CHAR_INFO* pDst = m_bufScreen + y * m_nScreenWidth;
+		for (int r = layer.m_rowRuns[y]; r < layer.m_rowRuns[y + 1]; r++) {
+			const ScreenLayer::sLayerRun& run = layer.m_runs[r];
+			int x1 = std::max((int) run.x, m_clip.x1);
+			int x2 = std::min(run.x + run.nLength, m_clip.x2);
+			if (x1 < x2)
+				memcpy(pDst + x1, pSrc + x1, (x2 - x1) * sizeof(CHAR_INFO));
+			Cover(y, x1, x2);
+		}
+	}
+}
+
+const sAtlasRegion* ConsoleGameEngine::AtlasRegion(const Sprite* sprite) {
+	if (m_pAtlas == nullptr)
+		m_pAtlas.reset(new SpriteAtlas());
+
+	return m_pAtlas->Get(sprite);
+}
+
+const sSpriteVariant* ConsoleGameEngine::SpriteVariant(const Sprite* sprite, int nStep, bool bMirror) {
+	if (m_pVariants == nullptr)
+		m_pVariants.reset(new SpriteVariants());
+
+	return m_pVariants->Get(sprite, nStep, bMirror);
+}
+
+void ConsoleGameEngine::RecycleSpriteCopies() {
+	// Copies of reloaded or freed sprites are never drawn again, and a full
+	// atlas has no room for the sprites still to come
+	bool bStale = m_nAtlasGeneration != m_pAssets->Generation();
+	m_nAtlasGeneration = m_pAssets->Generation();
+
+	if (m_pAtlas != nullptr && (bStale || m_pAtlas->IsFull()))
+		m_pAtlas->Clear();
+	if (m_pVariants != nullptr && bStale)
+		m_pVariants->Clear();
+}
+
+void ConsoleGameEngine::MarkDirty(int x1, int y1, int x2, int y2) {
+	if (m_bHeadless)
+		return;
+
+	Clip(x1, y1);
+	Clip(x2, y2);
+	if (x1 < x2 && y1 < y2)
+		m_vecDirty.push_back({(short) x1, (short) y1, (short) (x2 - 1), (short) (y2 - 1)});
+}
+
+void ConsoleGameEngine::DrawWireFrameModel(const std::vector<std::pair<float, float>>& vecModelCoordinates, float x, float y, float r, float s, short col, short c) {
+	sModelInstance instance = {x, y, r, s, col};
+	DrawWireFrameModels(vecModelCoordinates, &instance, 1, c);
+}
+
+void ConsoleGameEngine::DrawWireFrameModels(const std::vector<std::pair<float, float>>& vecModelCoordinates, const sModelInstance* pInstances, int nInstances, short c) {
+	int verts = (int) vecModelCoordinates.size();
+	if (verts == 0)
+		return;
+
+	if ((int) m_vecWireFrame.size() < verts)
+		m_vecWireFrame.resize(verts);
+
+	for (int n = 0; n < nInstances; n++) {
+		const sModelInstance& instance = pInstances[n];
+		TransformWireFrameModel(vecModelCoordinates.data(), verts, instance.x, instance.y, instance.r, instance.s, m_vecWireFrame.data());
+		DrawWireFrame(m_vecWireFrame.data(), verts, instance.col, c);
 	}
 }
 
+void ConsoleGameEngine::TransformWireFrameModel(const std::pair<float, float>* pModel, int nPoints, float x, float y, float r, float s, std::pair<float, float>* pOut) {
+	// pair.first = x coordinate
+	// pair.second = y coordinate
+	float fCos = cosf(r);
+	float fSin = sinf(r);
+
+	// Rotate, scale and translate, in that order so the points come out
+	// exactly as they did from three separate passes
+	for (int i = 0; i < nPoints; i++) {
+		float px = pModel[i].first;
+		float py = pModel[i].second;
+		pOut[i].first = (px * fCos - py * fSin) * s + x;
+		pOut[i].second = (px * fSin + py * fCos) * s + y;
+	}
+}
+
+void ConsoleGameEngine::DrawWireFrame(const std::pair<float, float>* pPoints, int nPoints, short col, short c) {
+	if (nPoints <= 0)
+		return;
+
+	// Draw Closed Polygon, the last edge comes back to the first point
+	for (int i = 0; i < nPoints - 1; i++)
+		DrawLine((int) pPoints[i].first, (int) pPoints[i].second, (int) pPoints[i + 1].first, (int) pPoints[i + 1].second, c, col);
+	DrawLine((int) pPoints[nPoints - 1].first, (int) pPoints[nPoints - 1].second, (int) pPoints[0].first, (int) pPoints[0].second, c, col);
+}
+
 ConsoleGameEngine::~ConsoleGameEngine() {
-	SetConsoleActiveScreenBuffer(m_hOriginalConsole);
+	if (!m_bHeadless)
+		SetConsoleActiveScreenBuffer(m_hOriginalConsole);
 	delete[] m_bufScreen;
 }
 
 void ConsoleGameEngine::Start() {
+	m_tpStart = std::chrono::steady_clock::now();
+	m_fTimeToFirstFrame = -1.0f;
+	m_fTimeToLoaded = -1.0f;
+
+	m_bGameFinished = false;
+	RegisterRunning(this);
+
 	// Start the thread
 	m_bAtomActive = true;
 	std::thread t = std::thread(&ConsoleGameEngine::GameThread, this);
 
 	// Wait for thread to be exited
 	t.join();
+
+	UnregisterRunning(this);
+}
+
+bool ConsoleGameEngine::RecordInput(std::wstring sFile) {
+	return m_inputLog.OpenWrite(sFile);
+}
+
+bool ConsoleGameEngine::ReplayInput(std::wstring sFile) {
+	if (!m_inputLog.OpenRead(sFile))
+		return false;
+
+	m_pInputSource = &m_inputLog;
+	return true;
+}
+
+void ConsoleGameEngine::SetRandomSeed(unsigned int nSeed) {
+	m_nRandomSeed = nSeed;
+}
+
+void ConsoleGameEngine::SetSessionSettings(const std::vector<char>& settings) {
+	m_vecSessionSettings = settings;
+}
+
+const std::vector<char>& ConsoleGameEngine::SessionSettings() const {
+	return m_vecSessionSettings;
+}
+
+void ConsoleGameEngine::SetInputSource(InputSource* pSource) {
+	m_pInputSource = (pSource != nullptr) ? pSource : &m_consoleInput;
+}
+
+std::minstd_rand& ConsoleGameEngine::Random() {
+	return m_random;
+}
+
+AssetCache& ConsoleGameEngine::Assets() {
+	return *m_pAssets;
+}
+
+void ConsoleGameEngine::SetAssetCache(std::shared_ptr<AssetCache> pAssets) {
+	m_pAssets = pAssets;
+}
+
+ThreadPool& ConsoleGameEngine::Workers() {
+	if (m_pWorkers == nullptr)
+		m_pWorkers.reset(new ThreadPool());
+	return *m_pWorkers;
+}
+
+bool ConsoleGameEngine::WatchAssets(std::wstring sFolder) {
+	std::unique_ptr<AssetWatcher> pWatcher(new AssetWatcher());
+	if (!pWatcher->Start(sFolder))
+		return false;
+
+	m_pWatcher = std::move(pWatcher);
+	return true;
+}
+
+float ConsoleGameEngine::TimeToFirstFrame() const {
+	return m_fTimeToFirstFrame;
+}
+
+float ConsoleGameEngine::TimeToLoaded() const {
+	return m_fTimeToLoaded;
+}
+
+void ConsoleGameEngine::LoadingFinished() {
+	m_fTimeToLoaded = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_tpStart).count();
+}
+
+bool ConsoleGameEngine::StartHeadless() {
+	m_random.seed(m_nRandomSeed);
+	m_inputFrame = sInputFrame();
+	return OnUserCreate();
+}
+
+bool ConsoleGameEngine::StepHeadless(const sInputFrame& input) {
+	m_inputFrame = input;
+	UpdateInput();
+	RecycleSpriteCopies();
+	return OnUserUpdate(m_inputFrame.fElapsedTime);
+}
+
+void ConsoleGameEngine::StopHeadless() {
+	OnUserDestroy();
+}
+
+bool ConsoleGameEngine::IsHeadless() const {
+	return m_bHeadless;
 }
 
 int ConsoleGameEngine::ScreenWidth() {
@@ -560,6 +1461,15 @@ int ConsoleGameEngine::ScreenHeight() {
 }
 
 void ConsoleGameEngine::GameThread() {
+	// A replay has to start from the same random state as the recording
+	if (m_inputLog.IsReplaying()) {
+		m_nRandomSeed = m_inputLog.Seed();
+		if (!m_inputLog.Settings().empty())
+			m_vecSessionSettings = m_inputLog.Settings();
+	}
+	m_inputLog.WriteHeader(m_nRandomSeed, m_vecSessionSettings);
+	m_random.seed(m_nRandomSeed);
+
 	// Create user resources as part of this thread
 	if (!OnUserCreate())
 		m_bAtomActive = false;
@@ -582,92 +1492,18 @@ void ConsoleGameEngine::GameThread() {
 			tp2 = std::chrono::system_clock::now();
 			std::chrono::duration<float> elapsedTime = tp2 - tp1;
 			tp1 = tp2;
-			float fElapsedTime = elapsedTime.count();
-
-			// Handle Keyboard Input
-			for (int i = 0; i < 256; i++) {
-				m_keyNewState[i] = GetAsyncKeyState(i);
-
-				m_keys[i].bPressed = false;
-				m_keys[i].bReleased = false;
-
-				if (m_keyNewState[i] != m_keyOldState[i]) {
-					if (m_keyNewState[i] & 0x8000) {
-						m_keys[i].bPressed = !m_keys[i].bHeld;
-						m_keys[i].bHeld = true;
-					} else {
-						m_keys[i].bReleased = true;
-						m_keys[i].bHeld = false;
-					}
-				}
-
-				m_keyOldState[i] = m_keyNewState[i];
-			}
-
-			// Handle Mouse Input - Check for window events
-			INPUT_RECORD inBuf[32];
-			DWORD events = 0;
-			GetNumberOfConsoleInputEvents(m_hConsoleIn, &events);
-			if (events > 0)
-				ReadConsoleInput(m_hConsoleIn, inBuf, events, &events);
-
-			// Handle events - we only care about mouse clicks and movement
-			// for now
-			for (DWORD i = 0; i < events; i++) {
-				switch (inBuf[i].EventType) {
-					case FOCUS_EVENT:
-					{
-						m_bConsoleInFocus = inBuf[i].Event.FocusEvent.bSetFocus;
-					}
-					break;
-
-					case MOUSE_EVENT:
-					{
-						switch (inBuf[i].Event.MouseEvent.dwEventFlags) {
-							case MOUSE_MOVED:
-							{
-								m_mousePosX = inBuf[i].Event.MouseEvent.dwMousePosition.X;
-								m_mousePosY = inBuf[i].Event.MouseEvent.dwMousePosition.Y;
-							}
-							break;
-
-							case 0:
-							{
-								for (int m = 0; m < 5; m++)
-									m_mouseNewState[m] = (inBuf[i].Event.MouseEvent.dwButtonState & (1 << m)) > 0;
-
-							}
-							break;
-
-							default:
-								break;
-						}
-					}
-					break;
 
-					default:
-						break;
-						// We don't care just at the moment
-				}
-			}
-
-			for (int m = 0; m < 5; m++) {
-				m_mouse[m].bPressed = false;
-				m_mouse[m].bReleased = false;
-
-				if (m_mouseNewState[m] != m_mouseOldState[m]) {
-					if (m_mouseNewState[m]) {
-						m_mouse[m].bPressed = true;
-						m_mouse[m].bHeld = true;
-					} else {
-						m_mouse[m].bReleased = true;
-						m_mouse[m].bHeld = false;
-					}
-				}
-
-				m_mouseOldState[m] = m_mouseNewState[m];
+			// Handle Input, a replayed frame also overrides the elapsed time
+			if (!ReadInput(elapsedTime.count())) {
+				m_bAtomActive = false;
+				break;
 			}
+			UpdateInput();
+			float fElapsedTime = m_inputFrame.fElapsedTime;
 
+			if (m_pWatcher != nullptr)
+				ReloadChangedAssets();
+			RecycleSpriteCopies();
 
 			// Handle Frame Update
 			if (!OnUserUpdate(fElapsedTime))
@@ -677,7 +1513,10 @@ void ConsoleGameEngine::GameThread() {
 			wchar_t s[256];
 			swprintf_s(s, 256, L"%s - FPS: %3.2f", m_sAppName.c_str(), 1.0f / fElapsedTime);
 			SetConsoleTitle(s);
-			WriteConsoleOutput(m_hConsole, m_bufScreen, {(short) m_nScreenWidth, (short) m_nScreenHeight}, {0,0}, &m_rectWindow);
+			Present();
+
+			if (m_fTimeToFirstFrame < 0.0f)
+				m_fTimeToFirstFrame = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_tpStart).count();
 		}
 
 		if (m_bEnableSound) {
@@ -687,9 +1526,14 @@ void ConsoleGameEngine::GameThread() {
 		// Allow the user to free resources if they have overrided the destroy function
 		if (OnUserDestroy()) {
 			// User has permitted destroy, so exit and clean up
+			m_inputLog.Close();
 			delete[] m_bufScreen;
+			m_bufScreen = nullptr;
 			SetConsoleActiveScreenBuffer(m_hOriginalConsole);
-			m_cvGameFinished.notify_one();
+
+			std::unique_lock<std::mutex> ul(m_muxGame);
+			m_bGameFinished = true;
+			m_cvGameFinished.notify_all();
 		} else {
 			// User denied destroy for some reason, so continue running
 			m_bAtomActive = true;
@@ -697,6 +1541,86 @@ void ConsoleGameEngine::GameThread() {
 	}
 }
 
+void ConsoleGameEngine::ReloadChangedAssets() {
+	for (auto& sFile : m_pWatcher->TakeChanges()) {
+		size_t nExt = sFile.rfind(L'.');
+		if (nExt == std::wstring::npos)
+			continue;
+
+		std::wstring sExt = sFile.substr(nExt);
+		std::transform(sExt.begin(), sExt.end(), sExt.begin(), towlower);
+		if (sExt == L".spr")
+			m_pAssets->ReloadAsync(Workers(), sFile);
+	}
+
+	m_pAssets->ApplyReloads();
+}
+
+void ConsoleGameEngine::Present() {
+	COORD bufferSize = {(short) m_nScreenWidth, (short) m_nScreenHeight};
+	if (m_vecDirty.empty()) {
+		WriteConsoleOutput(m_hConsole, m_bufScreen, bufferSize, {0,0}, &m_rectWindow);
+		return;
+	}
+
+	for (SMALL_RECT& rect : m_vecDirty)
+		WriteConsoleOutput(m_hConsole, m_bufScreen, bufferSize, {rect.Left, rect.Top}, &rect);
+	m_vecDirty.clear();
+}
+
+bool ConsoleGameEngine::ReadInput(float fElapsedTime) {
+	m_inputFrame.fElapsedTime = fElapsedTime;
+	if (!m_pInputSource->ReadFrame(m_inputFrame))
+		return false;
+
+	m_inputLog.WriteFrame(m_inputFrame);
+	return true;
+}
+
+void ConsoleGameEngine::UpdateInput() {
+	for (int i = 0; i < 256; i++) {
+		m_keyNewState[i] = m_inputFrame.GetKey(i) ? (short) 0x8000 : 0;
+
+		m_keys[i].bPressed = false;
+		m_keys[i].bReleased = false;
+
+		if (m_keyNewState[i] != m_keyOldState[i]) {
+			if (m_keyNewState[i] & 0x8000) {
+				m_keys[i].bPressed = !m_keys[i].bHeld;
+				m_keys[i].bHeld = true;
+			} else {
+				m_keys[i].bReleased = true;
+				m_keys[i].bHeld = false;
+			}
+		}
+
+		m_keyOldState[i] = m_keyNewState[i];
+	}
+
+	m_bConsoleInFocus = m_inputFrame.bFocused;
+	m_mousePosX = m_inputFrame.mousePosX;
+	m_mousePosY = m_inputFrame.mousePosY;
+
+	for (int m = 0; m < 5; m++) {
+		m_mouseNewState[m] = m_inputFrame.GetMouse(m);
+
+		m_mouse[m].bPressed = false;
+		m_mouse[m].bReleased = false;
+
+		if (m_mouseNewState[m] != m_mouseOldState[m]) {
+			if (m_mouseNewState[m]) {
+				m_mouse[m].bPressed = true;
+				m_mouse[m].bHeld = true;
+			} else {
+				m_mouse[m].bReleased = true;
+				m_mouse[m].bHeld = false;
+			}
+		}
+
+		m_mouseOldState[m] = m_mouseNewState[m];
+	}
+}
+
 bool ConsoleGameEngine::OnUserDestroy() {
 	return true;
 }
@@ -739,8 +1663,8 @@ ConsoleGameEngine::AudioSample::AudioSample(std::wstring sWavFile) {
 	std::fread(&dump, sizeof(char), 4, f); // Read chunk header
 	std::fread(&nChunksize, sizeof(long), 1, f); // Read chunk size
 	while (strncmp(dump, "data", 4) != 0) {
-		// Not audio data, so just skip it
-		std::fseek(f, nChunksize, SEEK_CUR);
+		// Not audio data, so just skip it and its pad byte
+		std::fseek(f, nChunksize + (nChunksize & 1), SEEK_CUR);
 		std::fread(&dump, sizeof(char), 4, f);
 		std::fread(&nChunksize, sizeof(long), 1, f);
 	}
@@ -768,20 +1692,84 @@ ConsoleGameEngine::AudioSample::AudioSample(std::wstring sWavFile) {
 	bSampleValid = true;
 }
 
+ConsoleGameEngine::AudioSample::AudioSample(const char* pData, size_t nSize, std::shared_ptr<const void> pOwner) {
+	const char* pEnd = pData + nSize;
+	if (nSize < 12 || strncmp(pData, "RIFF", 4) != 0 || strncmp(pData + 8, "WAVE", 4) != 0)
+		return;
+
+	// Walk the chunks, same as the file loader but without reading anything
+	const char* p = pData + 12;
+	bool bFormat = false;
+	while (p + 8 <= pEnd) {
+		long nChunksize = *(const int32_t*) (p + 4);
+		const char* pChunk = p + 8;
+		if (nChunksize < 0 || nChunksize > pEnd - pChunk)
+			return;
+
+		if (strncmp(p, "fmt ", 4) == 0) {
+			// A PCM format chunk is 16 bytes, everything up to cbSize
+			if (nChunksize < (long) (sizeof(WAVEFORMATEX) - 2))
+				return;
+			memcpy(&wavHeader, pChunk, sizeof(WAVEFORMATEX) - 2);
+			if (wavHeader.wBitsPerSample != 16 || wavHeader.nSamplesPerSec != 44100 || wavHeader.nChannels == 0)
+				return;
+			bFormat = true;
+		} else if (strncmp(p, "data", 4) == 0 && bFormat) {
+			nChannels = wavHeader.nChannels;
+			nSamples = nChunksize / (wavHeader.nChannels * (wavHeader.wBitsPerSample >> 3));
+			pPcm = (const short*) pChunk;
+			this->pOwner = pOwner;
+			bSampleValid = true;
+			return;
+		}
+
+		// Chunks are padded to an even length
+		long nStep = nChunksize + (nChunksize & 1);
+		if (nStep >= pEnd - pChunk)
+			return;
+		p = pChunk + nStep;
+	}
+}
+
+float ConsoleGameEngine::AudioSample::Sample(long i) const {
+	if (fSample != nullptr)
+		return fSample[i];
+	else
+		return (float) pPcm[i] / (float) (MAXSHORT);
+}
+
 unsigned int ConsoleGameEngine::LoadAudioSample(std::wstring sWavFile) {
 	if (!m_bEnableSound)
 		return -1;
 
-	AudioSample a(sWavFile);
-	if (a.bSampleValid) {
-		vecAudioSamples.push_back(a);
-		return vecAudioSamples.size();
-	} else
+	return AddAudioSample(ReadAudioSample(m_pAssets->Pack(), sWavFile));
+}
+
+std::future<ConsoleGameEngine::AudioSample> ConsoleGameEngine::LoadAudioSampleAsync(std::wstring sWavFile) {
+	std::shared_ptr<const AssetPack> pPack = m_pAssets->Pack();
+	return Workers().Async([pPack, sWavFile] { return ReadAudioSample(pPack, sWavFile); });
+}
+
+unsigned int ConsoleGameEngine::AddAudioSample(const AudioSample& sample) {
+	if (!m_bEnableSound || !sample.bSampleValid)
 		return -1;
+
+	vecAudioSamples.push_back(sample);
+	return vecAudioSamples.size();
+}
+
+ConsoleGameEngine::AudioSample ConsoleGameEngine::ReadAudioSample(std::shared_ptr<const AssetPack> pPack, std::wstring sWavFile) {
+	size_t nSize = 0;
+	const char* pData = pPack ? pPack->Find(sWavFile, PACK_SOUND, nSize) : nullptr;
+
+	return pData != nullptr ? AudioSample(pData, nSize, pPack) : AudioSample(sWavFile);
 }
 
 // Add sample 'id' to the mixers sounds to play list
 void ConsoleGameEngine::PlaySample(int id, bool bLoop) {
+	if (!m_bEnableSound)
+		return;
+
 	sCurrentlyPlayingSample a;
 	a.nAudioSampleID = id;
 	a.nSamplePosition = 0;
@@ -961,7 +1949,7 @@ float ConsoleGameEngine::GetMixerOutput(int nChannel, float fGlobalTime, float f
 
 		// If sample position is valid add to the mix
 		if (s.nSamplePosition < vecAudioSamples[s.nAudioSampleID - 1].nSamples)
-			fMixerSample += vecAudioSamples[s.nAudioSampleID - 1].fSample[(s.nSamplePosition * vecAudioSamples[s.nAudioSampleID - 1].nChannels) + nChannel];
+			fMixerSample += vecAudioSamples[s.nAudioSampleID - 1].Sample((s.nSamplePosition * vecAudioSamples[s.nAudioSampleID - 1].nChannels) + nChannel);
 		else
 			s.bFinished = true; // Else sound has completed
 	}
@@ -1006,16 +1994,34 @@ BOOL ConsoleGameEngine::CloseHandler(DWORD evt) {
 	// only exit when the game has finished cleaning up, or else
 	// the process will be killed before OnUserDestroy() has finished
 	if (evt == CTRL_CLOSE_EVENT) {
-		m_bAtomActive = false;
+		std::unique_lock<std::mutex> lr(m_muxRunning);
 
-		// Wait for thread to be exited
-		std::unique_lock<std::mutex> ul(m_muxGame);
-		m_cvGameFinished.wait(ul);
+		for (auto engine : m_vecRunning)
+			engine->m_bAtomActive = false;
+
+		// Wait for all game threads to be exited
+		for (auto engine : m_vecRunning) {
+			std::unique_lock<std::mutex> ul(engine->m_muxGame);
+			engine->m_cvGameFinished.wait(ul, [engine] { return engine->m_bGameFinished; });
+		}
 	}
 	return true;
 }
 
+void ConsoleGameEngine::RegisterRunning(ConsoleGameEngine* engine) {
+	std::unique_lock<std::mutex> lr(m_muxRunning);
+	if (m_vecRunning.empty())
+		SetConsoleCtrlHandler((PHANDLER_ROUTINE) CloseHandler, TRUE);
+	m_vecRunning.push_back(engine);
+}
+
+void ConsoleGameEngine::UnregisterRunning(ConsoleGameEngine* engine) {
+	std::unique_lock<std::mutex> lr(m_muxRunning);
+	m_vecRunning.erase(std::remove(m_vecRunning.begin(), m_vecRunning.end(), engine), m_vecRunning.end());
+	if (m_vecRunning.empty())
+		SetConsoleCtrlHandler((PHANDLER_ROUTINE) CloseHandler, FALSE);
+}
+
 // Define our static variables
-std::atomic<bool> ConsoleGameEngine::m_bAtomActive(false);
-std::condition_variable ConsoleGameEngine::m_cvGameFinished;
-std::mutex ConsoleGameEngine::m_muxGame;
+std::vector<ConsoleGameEngine*> ConsoleGameEngine::m_vecRunning;
+std::mutex ConsoleGameEngine::m_muxRunning;
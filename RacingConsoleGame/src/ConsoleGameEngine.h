@@ -14,6 +14,16 @@
 #include <thread>
 #include <atomic>
 #include <condition_variable>
+#include <mutex>
+#include <random>
+#include <memory>
+#include <future>
+#include <map>
+
+#include "SpriteFormat.h"
+#include "SpriteCodec.h"
+#include "InputSource.h"
+#include "InputLog.h"
 
 enum COLOUR {
 	FG_BLACK        = 0x0000,
@@ -58,6 +68,18 @@ enum PIXEL_TYPE {
 	PIXEL_QUARTER       = 0x2591,
 };
 
+// What sampling a sprite gives for coordinates off it
+enum SAMPLE_MODE {
+	SAMPLE_BORDER,		// a blank cell, like SampleGlyph() and SampleColour()
+	SAMPLE_CLAMP,		// the nearest cell on the edge
+	SAMPLE_WRAP,		// the sprite repeats
+};
+
+// DrawSpriteTransformed() keeps ready turned copies of a sprite for the
+// multiples of 2 pi / SPRITE_ANGLE_STEPS, round angles to these to draw them
+// as cheaply as DrawSprite()
+const int SPRITE_ANGLE_STEPS = 32;
+
 class Sprite {
 public:
 	Sprite();
@@ -66,34 +88,130 @@ public:
 
 	Sprite(std::wstring sFile);
 
+	// Wraps cells owned by someone else, e.g. a mapped asset pack, without
+	// copying them. The first SetGlyph/SetColour takes a private copy
+	Sprite(int w, int h, const CHAR_INFO* pCells);
+
+	~Sprite();
+
+	// Sprites own their cell buffers, share them through a handle instead
+	Sprite(const Sprite&) = delete;
+	Sprite& operator=(const Sprite&) = delete;
+
+	// Takes over the cells of other, which is left empty
+	Sprite& operator=(Sprite&& other);
+
 	int nWidth = 0;
 	int nHeight = 0;
 
+	// Changes whenever the cells do and is never the same for two sprites,
+	// even one made where a freed one was. Copies of sprites, e.g. in
+	// SpriteAtlas, are kept by it rather than by address
+	uint64_t Version() const;
+
 private:
-	short* m_Glyphs = nullptr;
-	short* m_Colours = nullptr;
+	// Same layout as the screen buffer and as the cells of a v2 file
+	CHAR_INFO* m_Cells = nullptr;
+	bool m_bOwned = true;
+
+	// Set instead of m_Cells for a sprite loaded from a compact file
+	std::unique_ptr<sSpriteSpans> m_pSpans;
+
+	uint64_t m_nVersion = NextVersion();
+	static uint64_t NextVersion();
 
 	void Create(int w, int h);
+	void Release();
+	void Detach();
+	const sSpriteCell* FindSpanCell(int x, int y) const;
+	void SampleCells(const int* pX, const int* pY, int nCount, CHAR_INFO* pOut, SAMPLE_MODE mode) const;
 
 public:
 	void SetGlyph(int x, int y, short c);
 
 	void SetColour(int x, int y, short c);
 
-	short GetGlyph(int x, int y);
+	short GetGlyph(int x, int y) const;
+
+	short GetColour(int x, int y) const;
+
+	short SampleGlyph(float x, float y) const;
+
+	short SampleColour(float x, float y) const;
 
-	short GetColour(int x, int y);
+	// SampleGlyph() and SampleColour() of nCount points at once, into pOut.
+	// Point i is (x + i * dx, y + i * dy), which walks one row of a scaled
+	// or rotated sprite
+	void SampleSpan(float x, float y, float dx, float dy, int nCount, CHAR_INFO* pOut, SAMPLE_MODE mode = SAMPLE_BORDER) const;
 
-	short SampleGlyph(float x, float y);
+	// The same for points given one by one
+	void SampleSpan(const float* pX, const float* pY, int nCount, CHAR_INFO* pOut, SAMPLE_MODE mode = SAMPLE_BORDER) const;
 
-	short SampleColour(float x, float y);
+	// Row major, nWidth * nHeight cells. nullptr for a compact sprite,
+	// which only has Spans() until the first SetGlyph/SetColour expands it
+	const CHAR_INFO* Cells() const;
+	const sSpriteSpans* Spans() const;
+	bool IsCompact() const;
 
-	bool Save(std::wstring sFile);
+	// Bytes of cell data held by this sprite
+	size_t Bytes() const;
 
+	// Always writes the v2 format, see SpriteFormat.h. bCompact uses the
+	// SpriteCodec encoding when it comes out smaller
+	bool Save(std::wstring sFile, bool bCompact = false) const;
+
+	// Reads v1 and v2 files
 	bool Load(std::wstring sFile);
 
+	// Same as Load() for a file already in memory. With bInPlace the cells
+	// of a v2 file are referenced rather than copied, pData must then
+	// outlive the sprite
+	bool Parse(const char* pData, size_t nSize, bool bInPlace);
+
+};
+
+struct sSpriteInstance {
+	int x;
+	int y;
 };
 
+// A block of cells with its mask, laid out as DrawCellsMasked() takes them
+struct sMaskedCells {
+	int nWidth;
+	int nHeight;
+	const CHAR_INFO* pCells;
+	const uint32_t* pMask;
+	int nStride;
+};
+
+// Where and how DrawWireFrameModels() draws one copy of a model
+struct sModelInstance {
+	float x;
+	float y;
+	float r;
+	float s;
+	short col;
+};
+
+// Cells x1 <= x < x2, y1 <= y < y2 of the screen
+struct sScreenRect {
+	int x1;
+	int y1;
+	int x2;
+	int y2;
+};
+
+class SpriteAtlas;
+class SpriteVariants;
+class ScreenLayer;
+struct sAtlasRegion;
+struct sSpriteVariant;
+
+class AssetCache;
+class AssetPack;
+class ThreadPool;
+class AssetWatcher;
+
 class ConsoleGameEngine {
 public:
 	ConsoleGameEngine();
@@ -104,6 +222,11 @@ public:
 
 	int ConstructConsole(int width, int height, int fontw, int fonth);
 
+	// Allocate the screen buffer only. The console is left untouched, sound is
+	// disabled and frames are driven by StepHeadless() instead of Start(), so
+	// many instances can run side by side, e.g. for batch simulation
+	int ConstructHeadless(int width, int height);
+
 	virtual void Draw(int x, int y, short c = PIXEL_TYPE::PIXEL_SOLID, short col = COLOUR::FG_WHITE);
 
 	void Fill(int x1, int y1, int x2, int y2, short c = PIXEL_TYPE::PIXEL_SOLID, short col = COLOUR::FG_WHITE);
@@ -120,19 +243,177 @@ public:
 
 	void FillTriangle(int x1, int y1, int x2, int y2, int x3, int y3, short c = PIXEL_TYPE::PIXEL_SOLID, short col = COLOUR::FG_WHITE);
 
+	// Fill the outline through nPoints points, closed back to the first,
+	// row by row. Three points go to FillTriangle() and come out identical.
+	// Edges of longer outlines take the cells FillTriangle() gives them,
+	// except on the row of a flat bottom edge, which FillTriangle() fills
+	// differently depending on the order of its vertices. Where the outline
+	// crosses itself the inside alternates
+	void FillPolygon(const std::pair<int, int>* pPoints, int nPoints, short c = PIXEL_TYPE::PIXEL_SOLID, short col = COLOUR::FG_WHITE);
+	void FillPolygon(const std::vector<std::pair<int, int>>& vecPoints, short c = PIXEL_TYPE::PIXEL_SOLID, short col = COLOUR::FG_WHITE);
+
 	void DrawCircle(int xc, int yc, int r, short c = PIXEL_TYPE::PIXEL_SOLID, short col = COLOUR::FG_WHITE);
 
 	void FillCircle(int xc, int yc, int r, short c = PIXEL_TYPE::PIXEL_SOLID, short col = COLOUR::FG_WHITE);
 
-	void DrawSprite(int x, int y, Sprite* sprite);
+	void DrawSprite(int x, int y, const Sprite* sprite);
+
+	void DrawPartialSprite(int x, int y, const Sprite* sprite, int ox, int oy, int w, int h);
+
+	// Draw sprite stretched over nWidth x nHeight cells, each cell takes the
+	// sprite cell under its centre
+	void DrawSpriteScaled(int x, int y, int nWidth, int nHeight, const Sprite* sprite);
+
+	// Draw sprite turned clockwise by fAngle radians and scaled by fScale
+	// about its centre, bMirror flips it left to right first. x, y is where
+	// DrawSprite() would put it untransformed. At scale 1 and a multiple of
+	// 2 pi / SPRITE_ANGLE_STEPS a cached copy is blitted, anything else is
+	// traced back onto the sprite cell by cell
+	void DrawSpriteTransformed(int x, int y, const Sprite* sprite, float fAngle, float fScale = 1.0f, bool bMirror = false);
+
+	// Make every cached copy of sprite for DrawSpriteTransformed() now, e.g.
+	// right after loading it, instead of on first use
+	void PrepareSpriteVariants(const Sprite* sprite);
+
+	// Copy a nWidth x nHeight block of cells, clipped to ClipRect(), whose
+	// rows are nStride cells apart. Every cell is drawn, spaces included
+	void DrawCells(int x, int y, int nWidth, int nHeight, const CHAR_INFO* pCells, int nStride);
+
+	// DrawCells() for blocks with holes in them. pMask holds 0xFFFFFFFF for
+	// every cell to draw and 0 for the ones the screen shows through. No
+	// branch per cell, so thin glyph strokes cost no more than solid blocks
+	void DrawCellsMasked(int x, int y, int nWidth, int nHeight, const CHAR_INFO* pCells, const uint32_t* pMask, int nStride);
+
+	// Draw sprite once at every position, as DrawSprite() would. The sprite
+	// is copied into this engine's SpriteAtlas on first use, after that an
+	// instance is a masked copy of its rows out of the atlas
+	void DrawSpriteInstances(const Sprite* sprite, const sSpriteInstance* pInstances, int nInstances);
+
+	// Copy sprite into the atlas now instead of on its first draw
+	void PrepareSprite(const Sprite* sprite);
+
+	// Where sprite's copy in the atlas is, for DrawCellsMaskedIn(). Returns
+	// false when it is not there. The atlas moves while it grows, so
+	// prepare every sprite of a frame before asking for any of them
+	bool AtlasCells(const Sprite* sprite, sMaskedCells& cells) const;
+
+	// Fill(), DrawCellsMasked(), DrawSprite(), DrawSpriteInstances(),
+	// DrawSpriteScaled() and DrawLine() touching only the cells inside clip,
+	// which has to lie on the screen. These may run on several threads at
+	// once for clip areas that do not overlap. DrawSpriteInstancesIn() only
+	// reads the atlas, sprites that did not go through PrepareSprite() are
+	// drawn cell by cell
+	void FillIn(const sScreenRect& clip, int x1, int y1, int x2, int y2, short c = PIXEL_TYPE::PIXEL_SOLID, short col = COLOUR::FG_WHITE);
+	void DrawCellsMaskedIn(const sScreenRect& clip, int x, int y, int nWidth, int nHeight, const CHAR_INFO* pCells, const uint32_t* pMask, int nStride);
+	void DrawSpriteIn(const sScreenRect& clip, int x, int y, const Sprite* sprite);
+	void DrawSpriteInstancesIn(const sScreenRect& clip, const Sprite* sprite, const sSpriteInstance* pInstances, int nInstances);
+	void DrawSpriteScaledIn(const sScreenRect& clip, int x, int y, int nWidth, int nHeight, const Sprite* sprite);
+	void DrawLineIn(const sScreenRect& clip, int x1, int y1, int x2, int y2, short c = PIXEL_TYPE::PIXEL_SOLID, short col = COLOUR::FG_WHITE);
+
+	sScreenRect ScreenRect() const;
+
+	// Keep drawing to x1 <= x < x2, y1 <= y < y2 of the current clip until
+	// the matching PopClip(), e.g. for a panel or a viewport. Every draw
+	// call, layers included, cuts its work to the clip before touching any
+	// cell, the *In() calls go by their own clip instead
+	void PushClip(int x1, int y1, int x2, int y2);
+	void PopClip();
+
+	// The area drawing is held to, the whole screen when nothing is pushed
+	sScreenRect ClipRect() const;
+
+	// The offscreen layer called sName, made on first use
+	ScreenLayer& GetLayer(const std::wstring& sName);
+
+	// Draw into layer instead of the screen until EndLayer(). Returns false,
+	// and EndLayer() is not called, when the layer still holds what was
+	// drawn into it before and nothing marked it dirty since, or when
+	// another layer is still being drawn
+	bool BeginLayer(ScreenLayer& layer);
+	void EndLayer();
+
+	// Copy the drawn cells of layer onto the screen, row by row
+	void DrawLayer(const ScreenLayer& layer);
+
+	// Present only the marked areas at the end of this frame, x2 and y2 are
+	// exclusive like Fill(). A frame that marks nothing presents the whole
+	// screen, so only games that track their changes need to call it
+	void MarkDirty(int x1, int y1, int x2, int y2);
+
+	// The model's outline rotated by r, scaled by s and moved to x, y. The
+	// transformed points go to scratch storage kept by the engine, so
+	// nothing is allocated once it has grown to the largest model
+	void DrawWireFrameModel(const std::vector<std::pair<float, float>>& vecModelCoordinates, float x, float y, float r = 0.0f, float s = 1.0f, short col = COLOUR::FG_WHITE, short c = PIXEL_TYPE::PIXEL_SOLID);
+
+	// The same model drawn once per instance, e.g. all the debris of a crash
+	void DrawWireFrameModels(const std::vector<std::pair<float, float>>& vecModelCoordinates, const sModelInstance* pInstances, int nInstances, short c = PIXEL_TYPE::PIXEL_SOLID);
 
-	void DrawPartialSprite(int x, int y, Sprite* sprite, int ox, int oy, int w, int h);
+	// Rotate, scale and move nPoints points of pModel into pOut in one pass,
+	// for callers that keep the transformed model themselves
+	static void TransformWireFrameModel(const std::pair<float, float>* pModel, int nPoints, float x, float y, float r, float s, std::pair<float, float>* pOut);
 
-	void DrawWireFrameModel(const std::vector<std::pair<float, float>>& vecModelCoordinates, float x, float y, float r = 0.0f, float s = 1.0f, short col = COLOUR::FG_WHITE, short c = PIXEL_TYPE::PIXEL_SOLID);
+	// Closed outline through nPoints already transformed points
+	void DrawWireFrame(const std::pair<float, float>* pPoints, int nPoints, short col = COLOUR::FG_WHITE, short c = PIXEL_TYPE::PIXEL_SOLID);
 
 public:
 	void Start();
 
+	// Record every frame's input, elapsed time and the random seed to sFile so
+	// the session can be reproduced later. Call before Start()
+	bool RecordInput(std::wstring sFile);
+
+	// Feed a previously recorded session back instead of the keyboard, mouse
+	// and clock. The game stops when the log runs out. Call before Start()
+	bool ReplayInput(std::wstring sFile);
+
+	// Seed of this instance's random generator, applied before OnUserCreate().
+	// Ignored when replaying, the seed stored in the log is used instead
+	void SetRandomSeed(unsigned int nSeed);
+
+	// Whatever else the game needs to play a session the same way again,
+	// stored in a recorded log next to the seed. When replaying a log that
+	// has them, SessionSettings() returns the recorded ones from
+	// OnUserCreate() on
+	void SetSessionSettings(const std::vector<char>& settings);
+	const std::vector<char>& SessionSettings() const;
+
+	// Take input from pSource instead of this instance's console. The engine
+	// does not own the source, nullptr switches back to the console
+	void SetInputSource(InputSource* pSource);
+
+	// Random generator of this instance, use it instead of rand() so engines
+	// running side by side do not disturb each other's sequence
+	std::minstd_rand& Random();
+
+	// Sprites are loaded through this cache so each file is read once. Every
+	// engine starts with its own, engines that share one also share sprites
+	AssetCache& Assets();
+	void SetAssetCache(std::shared_ptr<AssetCache> pAssets);
+
+	// Pool for background work such as loading assets, started on first use
+	ThreadPool& Workers();
+
+	// Reload sprites below sFolder whenever their file is saved, e.g. from
+	// the SpriteEditor, and show the new version from the next frame on.
+	// Call before Start()
+	bool WatchAssets(std::wstring sFolder);
+
+	// Startup of the last Start(), in seconds from the call. Time to first
+	// frame runs until a frame is on screen, time to loaded until the game
+	// called LoadingFinished(). Both are negative until they happened
+	float TimeToFirstFrame() const;
+	float TimeToLoaded() const;
+
+	// Headless frame loop, runs on the calling thread. StartHeadless() calls
+	// OnUserCreate(), every StepHeadless() runs one OnUserUpdate() with the
+	// given input and elapsed time, StopHeadless() calls OnUserDestroy().
+	// StartHeadless() and StepHeadless() return false once the game wants to stop
+	bool StartHeadless();
+	bool StepHeadless(const sInputFrame& input);
+	void StopHeadless();
+
+	bool IsHeadless() const;
+
 	int ScreenWidth();
 
 	int ScreenHeight();
@@ -140,12 +421,47 @@ public:
 private:
 	void GameThread();
 
+	// Sample the keyboard, console events and clock into m_inputFrame, either
+	// live or from the replay log. Returns false when the replay has ended
+	bool ReadInput(float fElapsedTime);
+
+	// Turn the held bits of m_inputFrame into m_keys[] and m_mouse[] edges
+	void UpdateInput();
+
+	// Write the screen buffer, or the areas marked dirty, to the console
+	void Present();
+
+	// Start reloading the sprite files the watcher saw change and swap in
+	// the ones that are done, between two frames
+	void ReloadChangedAssets();
+
+	// Where sprite is in m_pAtlas, nullptr when it does not fit
+	const sAtlasRegion* AtlasRegion(const Sprite* sprite);
+
+	// sprite turned to nStep, out of m_pVariants
+	const sSpriteVariant* SpriteVariant(const Sprite* sprite, int nStep, bool bMirror);
+
+	// Cells x1 to x2 of row y, both included, that lie inside clip
+	void FillSpanIn(const sScreenRect& clip, int y, int x1, int x2, short c, short col);
+
+	// Note cells x1 .. x2 - 1 of row y as drawn on while a layer is open
+	void Cover(int y, int x1, int x2);
+
+	// Between frames, empty m_pAtlas and m_pVariants if the cache changed
+	// sprites since, and m_pAtlas once it is full. Atlas regions handed out
+	// during a frame stay where they are until the frame is over
+	void RecycleSpriteCopies();
+
 public:
 	virtual bool OnUserCreate() = 0;
 	virtual bool OnUserUpdate(float fElapsedTime) = 0;
 
 	virtual bool OnUserDestroy();
 
+protected:
+	// Tell the engine every asset is in, for TimeToLoaded()
+	void LoadingFinished();
+
 // Audio Engine =====================================================================
 protected:
 	class AudioSample {
@@ -154,8 +470,16 @@ protected:
 
 		AudioSample(std::wstring sWavFile);
 
+		// Plays the 16-bit PCM of a wav file already in memory in place,
+		// pOwner keeps that memory alive for as long as the sample exists
+		AudioSample(const char* pData, size_t nSize, std::shared_ptr<const void> pOwner);
+
+		float Sample(long i) const;
+
 		WAVEFORMATEX wavHeader;
 		float* fSample = nullptr;
+		const short* pPcm = nullptr;
+		std::shared_ptr<const void> pOwner;
 		long nSamples = 0;
 		int nChannels = 0;
 		bool bSampleValid = false;
@@ -177,9 +501,17 @@ protected:
 	std::list<sCurrentlyPlayingSample> listActiveSamples;
 
 	// Load a 16-bit WAVE file @ 44100Hz ONLY into memory. A sample ID
-	// number is returned if successful, otherwise -1
+	// number is returned if successful, otherwise -1. Files in the asset
+	// pack are played from the pack instead of being read
 	unsigned int LoadAudioSample(std::wstring sWavFile);
 
+	// LoadAudioSample() in two steps, so the file can be read on a worker.
+	// AddAudioSample() must not run while a sample is playing
+	std::future<AudioSample> LoadAudioSampleAsync(std::wstring sWavFile);
+	unsigned int AddAudioSample(const AudioSample& sample);
+
+	static AudioSample ReadAudioSample(std::shared_ptr<const AssetPack> pPack, std::wstring sWavFile);
+
 	// Add sample 'id' to the mixers sounds to play list
 	void PlaySample(int id, bool bLoop = false);
 
@@ -268,10 +600,34 @@ protected:
 
 	static BOOL CloseHandler(DWORD evt);
 
+	// The console close handler is one per process and the OS calls it without
+	// any context, so it finds the instances to shut down through this list.
+	// Only engines inside Start() are in it, headless ones never are
+	static void RegisterRunning(ConsoleGameEngine* engine);
+	static void UnregisterRunning(ConsoleGameEngine* engine);
+
 protected:
 	int m_nScreenWidth;
 	int m_nScreenHeight;
 	CHAR_INFO* m_bufScreen;
+	std::vector<SMALL_RECT> m_vecDirty;
+
+	// PushClip() stack, m_clip is its top
+	std::vector<sScreenRect> m_vecClips;
+	sScreenRect m_clip;
+
+	// Transformed points of the model DrawWireFrameModel() is drawing
+	std::vector<std::pair<float, float>> m_vecWireFrame;
+
+	// Rows being filled by FillTriangle() and FillPolygon()
+	struct sSpan {
+		int y;
+		int x1;
+		int x2;
+	};
+	std::vector<std::pair<int, int>> m_vecRowSpans;
+	std::vector<sSpan> m_vecSpans;
+	std::vector<std::pair<int, double>> m_vecCrossings;
 	std::wstring m_sAppName;
 	HANDLE m_hOriginalConsole;
 	CONSOLE_SCREEN_BUFFER_INFO m_OriginalConsoleInfo;
@@ -284,10 +640,43 @@ protected:
 	bool m_mouseNewState[5] = {0};
 	bool m_bConsoleInFocus = true;
 	bool m_bEnableSound = false;
-
-	// These need to be static because of the OnDestroy call the OS may make. The OS
-	// spawns a special thread just for that
-	static std::atomic<bool> m_bAtomActive;
-	static std::condition_variable m_cvGameFinished;
-	static std::mutex m_muxGame;
+	bool m_bHeadless = false;
+
+	sInputFrame m_inputFrame;
+	ConsoleInput m_consoleInput;
+	InputSource* m_pInputSource;
+	InputLog m_inputLog;
+	unsigned int m_nRandomSeed;
+	std::vector<char> m_vecSessionSettings;
+	std::minstd_rand m_random;
+	std::shared_ptr<AssetCache> m_pAssets;
+
+	// Declared after m_pAssets, so its pending work finishes before the cache goes
+	std::unique_ptr<ThreadPool> m_pWorkers;
+	std::unique_ptr<AssetWatcher> m_pWatcher;
+
+	// Sprites drawn by DrawSpriteInstances() and DrawSpriteTransformed(),
+	// rebuilt when the cache's Generation() moves on or the atlas fills up
+	std::unique_ptr<SpriteAtlas> m_pAtlas;
+	std::unique_ptr<SpriteVariants> m_pVariants;
+	unsigned int m_nAtlasGeneration = 0;
+
+	std::map<std::wstring, std::unique_ptr<ScreenLayer>> m_mapLayers;
+	ScreenLayer* m_pDrawingLayer = nullptr;
+	CHAR_INFO* m_bufSavedScreen = nullptr;
+	uint32_t* m_pCoverage = nullptr;		// the open layer's, nullptr otherwise
+
+	std::chrono::steady_clock::time_point m_tpStart;
+	float m_fTimeToFirstFrame = -1.0f;
+	float m_fTimeToLoaded = -1.0f;
+
+	// Lifecycle of this instance. The OS calls CloseHandler() on a thread of
+	// its own, which waits on m_cvGameFinished until OnUserDestroy() is done
+	std::atomic<bool> m_bAtomActive;
+	bool m_bGameFinished = false;
+	std::condition_variable m_cvGameFinished;
+	std::mutex m_muxGame;
+
+	static std::vector<ConsoleGameEngine*> m_vecRunning;
+	static std::mutex m_muxRunning;
 };
\ No newline at end of file
@@ -0,0 +1,216 @@
+#include "DrawList.h"
+#include <algorithm>
+#include <atomic>
+
+void DrawList::Clear() {
+	m_vecCommands.clear();
+	m_nCulled = 0;
+}
+
+void DrawList::Fill(int nLayer, int x1, int y1, int x2, int y2, short c, short col) {
+	sDrawCommand cmd;
+	cmd.type = DRAW_FILL;
+	cmd.nLayer = nLayer;
+	cmd.nOrder = (int) m_vecCommands.size();
+	cmd.x1 = x1;
+	cmd.y1 = y1;
+	cmd.x2 = x2;
+	cmd.y2 = y2;
+	cmd.c = c;
+	cmd.col = col;
+	cmd.sprite = nullptr;
+	m_vecCommands.push_back(cmd);
+}
+
+void DrawList::DrawSprite(int nLayer, int x, int y, const Sprite* sprite) {
+	if (sprite == nullptr)
+		return;
+
+	sDrawCommand cmd;
+	cmd.type = DRAW_SPRITE;
+	cmd.nLayer = nLayer;
+	cmd.nOrder = (int) m_vecCommands.size();
+	cmd.x1 = x;
+	cmd.y1 = y;
+	cmd.x2 = x + sprite->nWidth;
+	cmd.y2 = y + sprite->nHeight;
+	cmd.c = 0;
+	cmd.col = 0;
+	cmd.sprite = sprite;
+	m_vecCommands.push_back(cmd);
+}
+
+void DrawList::Finish(int nWidth, int nHeight) {
+	// Only the part on the screen counts from here on
+	size_t nKept = 0;
+	for (auto& cmd : m_vecCommands) {
+		sDrawCommand clipped = cmd;
+		clipped.x1 = std::max(cmd.x1, 0);
+		clipped.y1 = std::max(cmd.y1, 0);
+		clipped.x2 = std::min(cmd.x2, nWidth);
+		clipped.y2 = std::min(cmd.y2, nHeight);
+		if (clipped.x1 >= clipped.x2 || clipped.y1 >= clipped.y2)
+			continue;
+
+		// A sprite keeps its position, only a fill can be cut down
+		if (cmd.type == DRAW_FILL)
+			m_vecCommands[nKept++] = clipped;
+		else
+			m_vecCommands[nKept++] = cmd;
+	}
+	m_nCulled = (int) (m_vecCommands.size() - nKept);
+	m_vecCommands.resize(nKept);
+
+	std::sort(m_vecCommands.begin(), m_vecCommands.end(), [] (const sDrawCommand& a, const sDrawCommand& b) {
+		return a.nLayer != b.nLayer ? a.nLayer < b.nLayer : a.nOrder < b.nOrder;
+	});
+
+	// Anything inside a fill that comes after it is never seen, fills are
+	// opaque. Walked back to front so each command only meets the fills
+	// drawn over it
+	m_vecFills.clear();
+	nKept = m_vecCommands.size();
+	for (size_t i = m_vecCommands.size(); i-- > 0;) {
+		const sDrawCommand& cmd = m_vecCommands[i];
+		int x1 = std::max(cmd.x1, 0);
+		int y1 = std::max(cmd.y1, 0);
+		int x2 = std::min(cmd.x2, nWidth);
+		int y2 = std::min(cmd.y2, nHeight);
+
+		bool bHidden = false;
+		for (int f : m_vecFills) {
+			const sDrawCommand& fill = m_vecCommands[f];
+			if (fill.x1 <= x1 && fill.y1 <= y1 && fill.x2 >= x2 && fill.y2 >= y2) {
+				bHidden = true;
+				break;
+			}
+		}
+
+		if (bHidden) {
+			m_vecCommands[i].nLayer = -1;
+			m_nCulled++;
+			nKept--;
+		} else if (cmd.type == DRAW_FILL) {
+			m_vecFills.push_back((int) i);
+		}
+	}
+
+	if (nKept != m_vecCommands.size()) {
+		m_vecCommands.erase(std::remove_if(m_vecCommands.begin(), m_vecCommands.end(),
+			[] (const sDrawCommand& cmd) { return cmd.nLayer < 0; }), m_vecCommands.end());
+	}
+}
+
+void DrawList::Execute(ConsoleGameEngine* engine) {
+	size_t i = 0;
+	while (i < m_vecCommands.size()) {
+		const sDrawCommand& cmd = m_vecCommands[i];
+		if (cmd.type == DRAW_FILL) {
+			engine->FillIn(engine->ClipRect(), cmd.x1, cmd.y1, cmd.x2, cmd.y2, cmd.c, cmd.col);
+			i++;
+			continue;
+		}
+
+		// Gather the run of this sprite into one batch
+		m_vecInstances.clear();
+		size_t j = i;
+		while (j < m_vecCommands.size() && m_vecCommands[j].type == DRAW_SPRITE && m_vecCommands[j].sprite == cmd.sprite) {
+			m_vecInstances.push_back({m_vecCommands[j].x1, m_vecCommands[j].y1});
+			j++;
+		}
+		engine->DrawSpriteInstances(cmd.sprite, m_vecInstances.data(), (int) m_vecInstances.size());
+		i = j;
+	}
+}
+
+void DrawList::ExecuteTiles(ConsoleGameEngine* engine, ThreadPool& pool, int nTileWidth, int nTileHeight) {
+	sScreenRect screen = engine->ScreenRect();
+	sScreenRect clip = engine->ClipRect();
+	int nTilesX = (screen.x2 + nTileWidth - 1) / nTileWidth;
+	int nTilesY = (screen.y2 + nTileHeight - 1) / nTileHeight;
+	int nTiles = nTilesX * nTilesY;
+	if (nTiles == 0)
+		return;
+
+	m_vecTiles.resize(nTiles);
+	m_vecBins.resize(nTiles);
+	for (int ty = 0; ty < nTilesY; ty++) {
+		for (int tx = 0; tx < nTilesX; tx++) {
+			int t = ty * nTilesX + tx;
+			m_vecTiles[t] = {std::max(tx * nTileWidth, clip.x1), std::max(ty * nTileHeight, clip.y1),
+							 std::min((tx + 1) * nTileWidth, clip.x2), std::min((ty + 1) * nTileHeight, clip.y2)};
+			m_vecBins[t].clear();
+		}
+	}
+
+	// Bin in drawing order. The atlas is only safe to read from the
+	// workers, so every sprite is put in it here
+	m_vecCells.resize(m_vecCommands.size());
+	for (size_t i = 0; i < m_vecCommands.size(); i++) {
+		const sDrawCommand& cmd = m_vecCommands[i];
+		int x1 = std::max(cmd.x1, clip.x1);
+		int y1 = std::max(cmd.y1, clip.y1);
+		int x2 = std::min(cmd.x2, clip.x2);
+		int y2 = std::min(cmd.y2, clip.y2);
+		if (x1 >= x2 || y1 >= y2)
+			continue;
+
+		if (cmd.type == DRAW_SPRITE)
+			engine->PrepareSprite(cmd.sprite);
+
+		for (int ty = y1 / nTileHeight; ty <= (y2 - 1) / nTileHeight; ty++)
+			for (int tx = x1 / nTileWidth; tx <= (x2 - 1) / nTileWidth; tx++)
+				m_vecBins[ty * nTilesX + tx].push_back((int) i);
+	}
+
+	// Then where each sprite ended up, the atlas no longer moves. Sprites
+	// it has no room for are drawn cell by cell
+	for (size_t i = 0; i < m_vecCommands.size(); i++) {
+		const sDrawCommand& cmd = m_vecCommands[i];
+		if (cmd.type == DRAW_SPRITE && !engine->AtlasCells(cmd.sprite, m_vecCells[i]))
+			m_vecCells[i].pCells = nullptr;
+	}
+
+	// Tiles are handed out one at a time, a worker still queued behind
+	// other tasks when the frame is done finds none left and returns
+	struct sTileJob {
+		std::atomic<int> nNext;
+		std::atomic<int> nDone;
+	};
+	std::shared_ptr<sTileJob> pJob = std::make_shared<sTileJob>();
+	pJob->nNext = 0;
+	pJob->nDone = 0;
+
+	auto DrawTiles = [this, engine, pJob, nTiles] {
+		int t;
+		while ((t = pJob->nNext++) < nTiles) {
+			for (int i : m_vecBins[t]) {
+				const sDrawCommand& cmd = m_vecCommands[i];
+				const sMaskedCells& cells = m_vecCells[i];
+				if (cmd.type == DRAW_FILL)
+					engine->FillIn(m_vecTiles[t], cmd.x1, cmd.y1, cmd.x2, cmd.y2, cmd.c, cmd.col);
+				else if (cells.pCells != nullptr)
+					engine->DrawCellsMaskedIn(m_vecTiles[t], cmd.x1, cmd.y1, cells.nWidth, cells.nHeight, cells.pCells, cells.pMask, cells.nStride);
+				else
+					engine->DrawSpriteIn(m_vecTiles[t], cmd.x1, cmd.y1, cmd.sprite);
+			}
+			pJob->nDone++;
+		}
+	};
+
+	unsigned int nHelpers = std::min(pool.Size(), (unsigned int) nTiles) - 1;
+	for (unsigned int i = 0; i < nHelpers; i++)
+		pool.Submit(DrawTiles);
+
+	DrawTiles();
+	while (pJob->nDone < nTiles)
+		std::this_thread::yield();
+}
+
+const std::vector<sDrawCommand>& DrawList::Commands() const {
+	return m_vecCommands;
+}
+
+int DrawList::Culled() const {
+	return m_nCulled;
+}
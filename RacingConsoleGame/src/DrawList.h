@@ -0,0 +1,72 @@
+#pragma once
+#include "ConsoleGameEngine.h"
+#include "ThreadPool.h"
+#include <vector>
+
+// Layers are drawn bottom to top, commands in one layer in the order they
+// were recorded
+enum DRAW_LAYER {
+	LAYER_BACKGROUND = 0,
+	LAYER_ROAD,
+	LAYER_VEHICLES,
+	LAYER_HUD,
+};
+
+enum DRAW_COMMAND {
+	DRAW_FILL,
+	DRAW_SPRITE,
+};
+
+struct sDrawCommand {
+	DRAW_COMMAND type;
+	int nLayer;
+	int nOrder;				// position in the recording
+	int x1, y1, x2, y2;		// cells covered, x2 and y2 excluded
+	short c;
+	short col;
+	const Sprite* sprite;
+};
+
+// Draw calls recorded for later instead of going to the screen at once.
+// Finish() drops whatever cannot be seen and puts the rest in drawing order,
+// Execute() then draws it in one pass and can be repeated, e.g. to redraw a
+// replayed frame, for as long as the recorded sprites are alive. Runs of the
+// same sprite are drawn with DrawSpriteInstances().
+class DrawList {
+public:
+	void Clear();
+
+	void Fill(int nLayer, int x1, int y1, int x2, int y2, short c = PIXEL_TYPE::PIXEL_SOLID, short col = COLOUR::FG_WHITE);
+	void DrawSprite(int nLayer, int x, int y, const Sprite* sprite);
+
+	// Cull against a nWidth x nHeight screen and sort by layer. Commands
+	// off the screen or hidden under a later fill are removed
+	void Finish(int nWidth, int nHeight);
+
+	// Draws within the engine's ClipRect()
+	void Execute(ConsoleGameEngine* engine);
+
+	// Execute() with the screen cut into nTileWidth x nTileHeight tiles that
+	// are drawn in parallel on pool. Every tile draws the commands touching
+	// it, in order and clipped to the tile, so the result is exactly that
+	// of Execute(). The calling thread draws tiles too and returns once all
+	// are done
+	void ExecuteTiles(ConsoleGameEngine* engine, ThreadPool& pool, int nTileWidth, int nTileHeight);
+
+	const std::vector<sDrawCommand>& Commands() const;
+
+	// Commands Finish() removed
+	int Culled() const;
+
+private:
+	std::vector<sDrawCommand> m_vecCommands;
+	std::vector<int> m_vecFills;
+	std::vector<sSpriteInstance> m_vecInstances;
+
+	// Commands touching each tile, and each sprite command's cells in the
+	// atlas, for ExecuteTiles()
+	std::vector<std::vector<int>> m_vecBins;
+	std::vector<sMaskedCells> m_vecCells;
+	std::vector<sScreenRect> m_vecTiles;
+	int m_nCulled = 0;
+};
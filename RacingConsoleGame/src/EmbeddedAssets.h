@@ -0,0 +1,136 @@
+// Generated by AssetPacker --embed, do not edit
+#pragma once
+#include "EmbeddedSprite.h"
+
+// assets/cars/car1.spr
+constexpr sFixedSprite<12, 16> EMBEDDED_assets_cars_car1_spr = {{
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x2588, 0x0007}, {0x2588, 0x0007}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0007}, {0x2588, 0x0007}, {0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x0020, 0x0000},
+	{0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x0020, 0x0000},
+}};
+
+// assets/cars/car2.spr
+constexpr sFixedSprite<12, 16> EMBEDDED_assets_cars_car2_spr = {{
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x2588, 0x0007}, {0x2588, 0x0007}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0007}, {0x2588, 0x0007}, {0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x000F}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000},
+	{0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000},
+}};
+
+// assets/cars/car3.spr
+constexpr sFixedSprite<13, 23> EMBEDDED_assets_cars_car3_spr = {{
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x2588, 0x0008}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x2588, 0x0008}, {0x2588, 0x0007}, {0x2588, 0x0007}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0007}, {0x2588, 0x0007}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x2588, 0x0008}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x2588, 0x0008}, {0x2588, 0x0008},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x2588, 0x0008}, {0x2588, 0x0008},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x2588, 0x0007}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0007}, {0x2588, 0x0008}, {0x2588, 0x0008},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x2588, 0x0008}, {0x2588, 0x0008},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x2588, 0x0008}, {0x2588, 0x0008},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0003}, {0x2588, 0x0003}, {0x2588, 0x0003}, {0x2588, 0x0003}, {0x2588, 0x0003}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0003}, {0x2588, 0x0003}, {0x2588, 0x0003}, {0x2588, 0x0003}, {0x2588, 0x0003}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+}};
+
+// assets/cars/car4.spr
+constexpr sFixedSprite<13, 23> EMBEDDED_assets_cars_car4_spr = {{
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x2588, 0x0001}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x2588, 0x0008}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x2588, 0x0008}, {0x2588, 0x0007}, {0x2588, 0x0007}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0007}, {0x2588, 0x0007}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x2588, 0x0008}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0008}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0000}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x00F8}, {0x2588, 0x00F8}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x2588, 0x00F8}, {0x2588, 0x00F8},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x2588, 0x0008}, {0x2588, 0x0008},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x2588, 0x00F7}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x00F7}, {0x2588, 0x0008}, {0x2588, 0x0008},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x2588, 0x0008}, {0x2588, 0x0008},
+	{0x2588, 0x0008}, {0x2588, 0x0008}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x2588, 0x0008}, {0x2588, 0x0008},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x00F3}, {0x2588, 0x00F3}, {0x2588, 0x00F3}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0003}, {0x2588, 0x0003}, {0x2588, 0x0003}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x2588, 0x00F1}, {0x2588, 0x00F1}, {0x2588, 0x00F1}, {0x2588, 0x00F1}, {0x2588, 0x00F1}, {0x2588, 0x00F1}, {0x2588, 0x00F1}, {0x2588, 0x00F1}, {0x2588, 0x00F1}, {0x2588, 0x00F1}, {0x2588, 0x00F1}, {0x2588, 0x00F1},
+}};
+
+// assets/font/atlas.spr
+constexpr sFixedSprite<576, 13> EMBEDDED_assets_font_atlas_spr = {{
+	{0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x2588, 0x0004}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+}};
+
+// assets/fontSmall/atlas.spr
+constexpr sFixedSprite<240, 7> EMBEDDED_assets_fontSmall_atlas_spr = {{
+	{0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006},
+	{0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006},
+	{0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000},
+	{0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000},
+	{0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006},
+	{0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x0020, 0x0000}, {0x0020, 0x0000}, {0x2588, 0x0006}, {0x2588, 0x0006},
+}};
+
+#define EMBEDDED_SPRITE_SIZES(X) X(12, 16) X(13, 23)
+
+constexpr sEmbeddedSprite EMBEDDED_SPRITES[] = {
+	{0x0E6A124Bu, EMBEDDED_assets_cars_car1_spr.Width(), EMBEDDED_assets_cars_car1_spr.Height(), EMBEDDED_assets_cars_car1_spr.cells},
+	{0xE20A895Au, EMBEDDED_assets_cars_car2_spr.Width(), EMBEDDED_assets_cars_car2_spr.Height(), EMBEDDED_assets_cars_car2_spr.cells},
+	{0x30A26131u, EMBEDDED_assets_cars_car3_spr.Width(), EMBEDDED_assets_cars_car3_spr.Height(), EMBEDDED_assets_cars_car3_spr.cells},
+	{0xA91F91E8u, EMBEDDED_assets_cars_car4_spr.Width(), EMBEDDED_assets_cars_car4_spr.Height(), EMBEDDED_assets_cars_car4_spr.cells},
+	{0x2A316E55u, EMBEDDED_assets_font_atlas_spr.Width(), EMBEDDED_assets_font_atlas_spr.Height(), EMBEDDED_assets_font_atlas_spr.cells},
+	{0xB04F1EF6u, EMBEDDED_assets_fontSmall_atlas_spr.Width(), EMBEDDED_assets_fontSmall_atlas_spr.Height(), EMBEDDED_assets_fontSmall_atlas_spr.cells},
+};
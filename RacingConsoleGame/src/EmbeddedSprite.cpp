@@ -0,0 +1,19 @@
+#include "EmbeddedSprite.h"
+#include "PackFormat.h"
+#include "EmbeddedAssets.h"
+
+const sEmbeddedSprite* FindEmbeddedSprite(const std::wstring& sName) {
+	uint32_t nHash = PackHash(sName);
+	for (const sEmbeddedSprite& sprite : EMBEDDED_SPRITES) {
+		if (sprite.nHash == nHash)
+			return &sprite;
+	}
+	return nullptr;
+}
+
+FIXED_BLIT FindFixedBlit(int nWidth, int nHeight) {
+#define FIXED_BLIT_CASE(W, H) if (nWidth == W && nHeight == H) return &BlitFixed<W, H>;
+	EMBEDDED_SPRITE_SIZES(FIXED_BLIT_CASE)
+#undef FIXED_BLIT_CASE
+	return nullptr;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "SpriteFormat.h"
+#include <windows.h>
+#include <string>
+#include <utility>
+
+// Sprites compiled into the game. EmbeddedAssets.h is generated from the
+// .spr files under assets/ by AssetPacker --embed before every build and
+// holds one sFixedSprite per file, so built-in art costs no file I/O.
+template<int W, int H>
+struct sFixedSprite {
+	sSpriteCell cells[W * H];
+
+	static constexpr int Width() { return W; }
+	static constexpr int Height() { return H; }
+};
+
+struct sEmbeddedSprite {
+	uint32_t nHash;		// PackHash() of the asset name
+	int nWidth;
+	int nHeight;
+	const sSpriteCell* pCells;
+};
+
+// nullptr when the sprite is not built in
+const sEmbeddedSprite* FindEmbeddedSprite(const std::wstring& sName);
+
+// Copies the drawable cells of a W x H sprite that lies fully inside the
+// destination. Every cell is its own statement with a constant offset, no
+// loop counters and no bounds checks
+template<int W, size_t... I>
+inline void BlitFixedCells(CHAR_INFO* pDst, int nStride, const CHAR_INFO* pSrc, std::index_sequence<I...>) {
+	int expand[] = { 0, (pSrc[I].Char.UnicodeChar != L' ' ? (pDst[(I / W) * nStride + I % W] = pSrc[I], 0) : 0)... };
+	(void) expand;
+}
+
+template<int W, int H>
+void BlitFixed(CHAR_INFO* pDst, int nStride, const CHAR_INFO* pSrc) {
+	BlitFixedCells<W>(pDst, nStride, pSrc, std::make_index_sequence<W * H>());
+}
+
+typedef void (*FIXED_BLIT)(CHAR_INFO* pDst, int nStride, const CHAR_INFO* pSrc);
+
+// The BlitFixed instance for the size of a built-in sprite, nullptr for any
+// other size
+FIXED_BLIT FindFixedBlit(int nWidth, int nHeight);
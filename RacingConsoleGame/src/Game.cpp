@@ -1,16 +1,60 @@
 #include "Game.h"
+#include <cstring>
+
+namespace {
+	// GameConfig as it is stored in recorded logs, a fixed layout so a log
+	// replays the same whichever build wrote it
+	struct sConfigRecord {
+		int32_t nNpc;
+		float fDelay;
+		float fSpeedUp;
+		int32_t nMaxSpeed;
+		uint32_t nTrackSeed;
+		uint32_t bPerspective;
+	};
+
+	std::vector<char> SaveConfig(const GameConfig& config) {
+		sConfigRecord record = {config.nNpc, config.fDelay, config.fSpeedUp, config.nMaxSpeed,
+								config.nTrackSeed, config.bPerspective ? 1u : 0u};
+		return std::vector<char>((const char*) &record, (const char*) &record + sizeof(record));
+	}
+
+	bool LoadConfig(const std::vector<char>& data, GameConfig& config) {
+		sConfigRecord record;
+		if (data.size() != sizeof(record))
+			return false;
+
+		memcpy(&record, data.data(), sizeof(record));
+		if (record.nNpc < 1)
+			return false;
+
+		config.nNpc = record.nNpc;
+		config.fDelay = record.fDelay;
+		config.fSpeedUp = record.fSpeedUp;
+		config.nMaxSpeed = record.nMaxSpeed;
+		config.nTrackSeed = record.nTrackSeed;
+		config.bPerspective = record.bPerspective != 0;
+		return true;
+	}
+}
 
-Game::Game() {
+Game::Game(const GameConfig& config) {
 	m_sAppName = L"Racing Console Game";
 
+	this->config = config;
+
 	pBorder = nullptr;
 
 	pPlayer = nullptr;
 
-	for (int i = 0; i < NPC; i++)
-		pNpc[i] = nullptr;
+	pNpc.assign(config.nNpc, nullptr);
 
 	pFont = nullptr;
+	pTitleFont = nullptr;
+	pHud = nullptr;
+	pRoad = nullptr;
+	pTrack = nullptr;
+	pPerspective = nullptr;
 
 	speed = 0;
 	interval = 0;
@@ -19,63 +63,211 @@ Game::Game() {
 	hitSoundEffect = 0;
 	score = 0;
 	highScore = 0;
+	gameOver = false;
+	crashTime = 0;
+	assetGeneration = 0;
+	roadDistance = 0;
+	loading = false;
+	loadingTime = 0;
 
+	SetSessionSettings(SaveConfig(config));
 	EnableSound();
 }
 
 bool Game::OnUserCreate() {
+	// A replayed log brings the settings it was recorded with
+	if (LoadConfig(SessionSettings(), config))
+		pNpc.assign(config.nNpc, nullptr);
+
 	// Instantiate border
 	pBorder = new Rect(BORDER_X, BORDER_Y, BORDER_WIDTH, BORDER_HEIGHT);
 
-	// Load players sprite
-	pPlayer = new Car(L"assets/cars/car2.spr");
+	delay = config.fDelay;
+	speed = 1;
+	gameOver = false;
+
+	if (config.nTrackSeed != 0)
+		pTrack = new Track(config.nTrackSeed, BORDER_X, BORDER_X + BORDER_WIDTH);
+
+	if (!IsHeadless() && config.bPerspective)
+		pPerspective = new PerspectiveRoad(*pBorder, BORDER_WIDTH);
+	else if (!IsHeadless())
+		pRoad = new ScrollingBackground(BORDER_WIDTH, BORDER_HEIGHT, [this] (long row, CHAR_INFO* cells, int width) { RoadRow(row, cells, width); });
+
+	// A recorded or replayed session has to start playing on the same frame
+	// every time, so only the live game streams its assets in
+	if (IsHeadless() || m_inputLog.IsRecording() || m_inputLog.IsReplaying()) {
+		// Load Fonts Sprites, nothing is drawn when running headless
+		if (!IsHeadless()) {
+			pFont = new Font(Assets(), L"assets/fontSmall");
+			pTitleFont = new Font(Assets(), L"assets/font");
+			CreateHud();
+		}
+
+		CreateCars(Assets().LoadSprite(PLAYER_SPRITE), Assets().LoadSprite(NPC_SPRITE));
+		hitSoundEffect = LoadAudioSample(L"assets/soundFX/vine_boom.wav");
 
-	//Load NPCs sprite
-	for (int i = 0; i < NPC; i++)
-		pNpc[i] = new Car(L"assets/cars/car1.spr");
+		LoadingFinished();
+		return true;
+	}
+
+	// Everything is read on the worker pool while the title screen shows,
+	// the title font first so the title can come up as early as possible
+	AssetCache& assets = Assets();
+	titleFontFuture = Workers().Async([&assets] { return std::unique_ptr<Font>(new Font(assets, L"assets/font")); });
+	fontFuture = Workers().Async([&assets] { return std::unique_ptr<Font>(new Font(assets, L"assets/fontSmall")); });
+	playerSpriteFuture = assets.LoadSpriteAsync(Workers(), PLAYER_SPRITE);
+	npcSpriteFuture = assets.LoadSpriteAsync(Workers(), NPC_SPRITE);
+	hitSoundFuture = LoadAudioSampleAsync(L"assets/soundFX/vine_boom.wav");
+
+	loading = true;
+	loadingTime = 0;
+	return true;
+}
 
+void Game::CreateCars(std::shared_ptr<const Sprite> playerSprite, std::shared_ptr<const Sprite> npcSprite) {
+	// Load players sprite, turned ahead of time for leaning and spinning
+	// unless nothing is going to be drawn
+	pPlayer = new Car(playerSprite);
+	if (!IsHeadless())
+		PrepareSpriteVariants(playerSprite.get());
 
-	// Load Fonts Sprites
-	pFont = new Font(L"assets/fontSmall");
-	pTitleFont = new Font(L"assets/font");
+	//Load NPCs sprite, they all share the one copy held by the cache
+	for (int i = 0; i < NpcCount(); i++)
+		pNpc[i] = new Car(npcSprite);
 
 	//Randomize NPC's X coordinate, restricted by the border
-	for (int i = 0; i < NPC; i++) {
-		pNpc[i]->RandomizeX(pBorder->Left(), pBorder->Right() - pNpc[i]->Width());
-		pNpc[i]->SetY(0 - ((pBorder->Height() / NPC) * i));
+	RandomizeNPC();
+
+	pPlayer->SetPosition(60, pBorder->Bottom() - 2 * pPlayer->Height());
+}
+
+void Game::CreateHud() {
+	pHud = new HudPanel(Rect(MENU_X, MENU_Y, MENU_WIDTH, MENU_HEIGHT), 10, 30, 13, BACK_GROUND);
+	pHud->Add(std::unique_ptr<HudWidget>(new HudCounter(pFont, "YOUR SCORE ", &score)));
+	pHud->Add(std::unique_ptr<HudWidget>(new HudCounter(pFont, "HIGH SCORE ", &highScore)));
+	pHud->Add(std::unique_ptr<HudWidget>(new HudLabel(pFont, "SPEED")));
+	pHud->Add(std::unique_ptr<HudWidget>(new HudBar(&speed, config.nMaxSpeed, 60, 3, FG_DARK_YELLOW)));
+}
+
+void Game::UpdateLoading(float fElapsedTime) {
+	loadingTime += fElapsedTime;
+
+	if (pTitleFont == nullptr && IsReady(titleFontFuture))
+		pTitleFont = titleFontFuture.get().release();
+
+	int nReady = (pTitleFont != nullptr) + IsReady(fontFuture) + IsReady(playerSpriteFuture) +
+		IsReady(npcSpriteFuture) + IsReady(hitSoundFuture);
+	const int nAssets = 5;
+
+	ClearScreen();
+
+	// Road markings scrolling past, so the screen shows it is alive
+	int nScroll = (int) (loadingTime * 60.0f) % 16;
+	for (int y = -16; y < BORDER_HEIGHT; y += 16)
+		Fill(BORDER_WIDTH / 2 - 1, y + nScroll, BORDER_WIDTH / 2 + 1, y + nScroll + 9, PIXEL_SOLID, FG_DARK_YELLOW);
+
+	if (pTitleFont != nullptr)
+		TitleScreen();
+
+	int nBarX = 30;
+	int nBarY = SCREEN_HEIGHT / 2 + 20;
+	int nBarWidth = SCREEN_WIDTH - 2 * nBarX;
+	Fill(nBarX, nBarY, nBarX + nBarWidth, nBarY + 3, PIXEL_SOLID, FG_DARK_GREY);
+	Fill(nBarX, nBarY, nBarX + nBarWidth * nReady / nAssets, nBarY + 3, PIXEL_SOLID, FG_WHITE);
+
+	if (nReady < nAssets)
+		return;
+
+	pFont = fontFuture.get().release();
+	CreateHud();
+	CreateCars(playerSpriteFuture.get(), npcSpriteFuture.get());
+	hitSoundEffect = AddAudioSample(hitSoundFuture.get());
+
+	loading = false;
+	LoadingFinished();
+}
+
+bool Game::OnUserUpdate(float fElapsedTime) {
+	if (loading) {
+		UpdateLoading(fElapsedTime);
+		return true;
 	}
 
-	hitSoundEffect = LoadAudioSample(L"assets/soundFX/vine_boom.wav");
+	// The cars hold on to the sprites they were made with, a reload puts
+	// new ones in the cache, possibly of another size
+	if (assetGeneration != Assets().Generation()) {
+		assetGeneration = Assets().Generation();
+		std::shared_ptr<const Sprite> playerSprite = Assets().LoadSprite(PLAYER_SPRITE);
+		std::shared_ptr<const Sprite> npcSprite = Assets().LoadSprite(NPC_SPRITE);
+		pPlayer->SetSprite(playerSprite);
+		if (!IsHeadless())
+			PrepareSpriteVariants(playerSprite.get());
+		for (int i = 0; i < NpcCount(); i++)
+			pNpc[i]->SetSprite(npcSprite);
+	}
 
-	pPlayer->SetPosition(60, pBorder->Bottom() - 2 * pPlayer->Height());
+	// Keep the crash on screen until SPACE is pressed. This goes through m_keys
+	// instead of polling the keyboard so it is recorded and replayed as well
+	if (gameOver) {
+		// One whole turn, kept to the angles the engine has ready
+		if (!IsHeadless() && crashTime < CRASH_SPIN_TIME) {
+			crashTime = std::min(crashTime + fElapsedTime, CRASH_SPIN_TIME);
+			int step = (int) (crashTime / CRASH_SPIN_TIME * SPRITE_ANGLE_STEPS) % SPRITE_ANGLE_STEPS;
+			pPlayer->SetAngle(step * 6.28318530718f / SPRITE_ANGLE_STEPS);
+			DrawWorld();
+		}
 
-	delay = 0.005f;
-	speed = 1;
-	gameOver = false;
+		if (m_keys[VK_SPACE].bPressed) {
+			Spawn(pPlayer);
+			RandomizeNPC();
+			score = 0;
+			speed = 1;
+			gameOver = false;
+		}
+		return true;
+	}
+
+	UpdateWorld(fElapsedTime);
 
-	//TitleScreen();
-	//WaitKey(VK_SPACE);
+	if (!IsHeadless())
+		DrawWorld();
 
 	return true;
 }
 
-bool Game::OnUserUpdate(float fElapsedTime) {
-	ClearScreen();
+bool Game::OnUserDestroy() {
+	delete pBorder;
+	delete pPlayer;
 
-	timeSinceStart += fElapsedTime;
-	interval += fElapsedTime;
+	for (int i = 0; i < NpcCount(); i++)
+		delete pNpc[i];
 
-	//pFont->DrawString(this, "RUN TIME ", MENU_X + 10, 0);
-	//pFont->DrawString(this, std::to_string(timeSinceStart), pFont->GetLastPosition());
+	delete pFont;
+	delete pTitleFont;
+	delete pHud;
+	delete pRoad;
+	delete pTrack;
+	delete pPerspective;
 
-	pFont->DrawString(this, "YOUR SCORE ", MENU_X + 10, 30);
-	pFont->DrawString(this, std::to_string(score), pFont->GetLastPosition());
+	pBorder = nullptr;
+	pPlayer = nullptr;
+	pNpc.assign(NpcCount(), nullptr);
+	pFont = nullptr;
+	pTitleFont = nullptr;
+	pHud = nullptr;
+	pRoad = nullptr;
+	pTrack = nullptr;
+	pPerspective = nullptr;
+	return true;
+}
 
-	pFont->DrawString(this, "HIGH SCORE ", MENU_X + 10, 50);
-	pFont->DrawString(this, std::to_string(highScore), pFont->GetLastPosition());
+void Game::UpdateWorld(float fElapsedTime) {
+	timeSinceStart += fElapsedTime;
+	interval += fElapsedTime;
 
 	if (m_keys[VK_UP].bPressed) {
-		if(speed < 4)
+		if(speed < config.nMaxSpeed)
 			speed++;
 	}
 
@@ -93,68 +285,137 @@ bool Game::OnUserUpdate(float fElapsedTime) {
 		pPlayer->MoveDown(speed);
 	}
 
+	int tilt = 0;
+
 	if (m_keys[VK_RIGHT].bHeld) {
 		pPlayer->MoveRight(speed);
+		tilt += CAR_TILT_STEPS;
 	}
 
 	if (m_keys[VK_LEFT].bHeld) {
 		pPlayer->MoveLeft(speed);
+		tilt -= CAR_TILT_STEPS;
 	}
 
+	pPlayer->SetAngle(tilt * 6.28318530718f / SPRITE_ANGLE_STEPS);
+
+	delay = config.fDelay / (1.0f + config.fSpeedUp * score);
+
 	if (interval > delay) {
-		//DrawLine();
-		for (int i = 0; i < NPC; i++) {
+		for (int i = 0; i < NpcCount(); i++) {
 			pNpc[i]->MoveDown(speed);
 		}
+		roadDistance += speed;
+
+		// Keep the track from the bottom of the screen onwards
+		if (pTrack != nullptr)
+			pTrack->Forget(roadDistance - BORDER_HEIGHT);
 		score++;
 		interval = 0;
 	}
 
-	pPlayer->ClipToTight(*pBorder, 1);
+	pPlayer->ClipToTight(RoadAt(pPlayer->Top(), pPlayer->Height()), 1);
 
-	for (int i = 0; i < NPC; i++) {
+	for (int i = 0; i < NpcCount(); i++) {
 		if (pPlayer->CollisionWith(*pNpc[i])) {
 			PlaySample(hitSoundEffect);
-			WaitKey(VK_SPACE);
-			Spawn(pPlayer);
 			if(score > highScore)
 				highScore = score;
 
-			score = 0;
-			speed = 1;
+			gameOver = true;
+			crashTime = 0;
+			break;
+		}
+	}
 
-			for (int i = 0; i < NPC; i++) {
-				pNpc[i]->RandomizeX(pBorder->Left(), pBorder->Right() - pNpc[i]->Width());
-				pNpc[i]->SetY(0 - ((BORDER_HEIGHT / NPC) * i));
-			}
+	for (int i = 0; i < NpcCount(); i++) {
+		if (pNpc[i]->OutOfBound(*pBorder)) {
+			Rect road = RoadAt(-50, pNpc[i]->Height());
+			pNpc[i]->RandomizeX(road.Left(), road.Right() - pNpc[i]->Width(), Random());
+			pNpc[i]->SetY(-50);
 		}
 	}
+}
 
-	pPlayer->DrawSelf(this);
+void Game::DrawWorld() {
+	// Only the road is presented every frame, the panel takes care of its
+	// own cells
+	MarkDirty(BORDER_X, BORDER_Y, BORDER_X + BORDER_WIDTH, BORDER_Y + BORDER_HEIGHT);
+
+	pHud->Draw(this);
+
+	// Nothing on the road spills onto the panel, a car half off the side
+	// included
+	PushClip(BORDER_X, BORDER_Y, BORDER_X + BORDER_WIDTH, BORDER_Y + BORDER_HEIGHT);
 
-	for (int i = 0; i < NPC; i++) {
-		pNpc[i]->DrawSelf(this);
+	if (pPerspective != nullptr) {
+		pPerspective->Draw(this, pTrack, roadDistance, *pPlayer, pNpc);
+		PopClip();
+		return;
 	}
 
-	for (int i = 0; i < NPC; i++) {
-		if (pNpc[i]->OutOfBound(*pBorder)) {
-			pNpc[i]->RandomizeX(pBorder->Left(), pBorder->Right() - pNpc[i]->Width());
-			pNpc[i]->SetY(-50);
-		}
+	// The road scrolls along with the traffic, only the rows coming in at
+	// the top are new
+	pRoad->Scroll((int) (roadDistance - pRoad->Position()));
+	pRoad->DrawTo(this, BORDER_X, BORDER_Y);
+
+	// The border never changes, it is drawn once and then copied over the cars
+	ScreenLayer& border = GetLayer(L"border");
+	if (BeginLayer(border)) {
+		pBorder->DrawSelf(this, PIXEL_BLANK, BG_DARK_RED);
+		EndLayer();
 	}
 
-	pBorder->DrawSelf(this, PIXEL_BLANK, BG_DARK_RED);
+	// The cars are recorded and drawn in one go, so NPCs still waiting above
+	// the screen cost nothing and the ones sharing a sprite are batched
+	drawList.Clear();
+
+	for (int i = 0; i < NpcCount(); i++) {
+		pNpc[i]->DrawSelf(drawList, LAYER_VEHICLES);
+	}
+
+	drawList.Finish(ScreenWidth(), ScreenHeight());
+	drawList.Execute(this);
+
+	// The player leans and spins, which the list has no command for
+	pPlayer->DrawSelf(this);
+
+	DrawLayer(border);
+	PopClip();
 
 	////DrawBorder();
-	return true;
 }
 
-bool Game::OnUserDestroy() {
-	delete pBorder;
-	delete pPlayer;
+const Rect& Game::Border() const {
+	return *pBorder;
+}
 
-	delete pFont;
-	return true;
+const Car& Game::Player() const {
+	return *pPlayer;
+}
+
+int Game::NpcCount() const {
+	return (int) pNpc.size();
+}
+
+const Car& Game::Npc(int i) const {
+	return *pNpc[i];
+}
+
+int Game::Score() const {
+	return score;
+}
+
+int Game::Speed() const {
+	return speed;
+}
+
+float Game::TimeSinceStart() const {
+	return timeSinceStart;
+}
+
+bool Game::IsGameOver() const {
+	return gameOver;
 }
 
 void Game::ClearScreen() {
@@ -179,10 +440,6 @@ void Game::FillRainbow() {
 	}
 }
 
-void Game::WaitKey(int vKey) {
-	while ((0x8000 & GetAsyncKeyState(vKey)) == 0);
-}
-
 void Game::FillGrid() {
 	for (int i = 0; i < ScreenWidth(); i++) {
 		for (int j = 0; j < ScreenHeight(); j++) {
@@ -200,27 +457,81 @@ void Game::DrawBorder() {
 	}
 }
 
+void Game::RandomizeNPC() {
+	for (int i = 0; i < NpcCount(); i++) {
+		int y = 0 - ((pBorder->Height() / NpcCount()) * i);
+		Rect road = RoadAt(y, pNpc[i]->Height());
+		pNpc[i]->RandomizeX(road.Left(), road.Right() - pNpc[i]->Width(), Random());
+		pNpc[i]->SetY(y);
+	}
+}
+
 void Game::Spawn(Car* car) {
 	car->SetPosition(60, pBorder->Bottom() - 2 * pPlayer->Height());
+	car->SetAngle(0);
 }
 
-void Game::DrawLine(){
-	static int k = 0;
+void Game::RoadRow(long row, CHAR_INFO* cells, int width) {
+	for (int x = 0; x < width; x++) {
+		cells[x].Char.UnicodeChar = PIXEL_BLANK;
+		cells[x].Attributes = BACK_GROUND;
+	}
+
+	// Dashed lane markings, 9 rows on and 7 off
+	long dash = row % 16;
+	if (dash < 0)
+		dash += 16;
 
-	for(int i = 0; i <= 1; i++){
-		for (int j = 0; j < BORDER_HEIGHT; j++){
-			if (j % 16 >= 0 && j % 16 <= 8){
-				Draw(BORDER_WIDTH/2 - 1 + i, j+k, PIXEL_SOLID, FG_DARK_YELLOW);
+	if (pTrack == nullptr) {
+		if (dash <= 8) {
+			for (int x = width / 2 - 1; x <= width / 2; x++) {
+				cells[x].Char.UnicodeChar = PIXEL_SOLID;
+				cells[x].Attributes = FG_DARK_YELLOW;
 			}
 		}
+		return;
+	}
+
+	// Grass beside the road, solid edge lines and a dash between each lane
+	TrackRow road = pTrack->Row(row);
+	int left = road.left - BORDER_X;
+	int right = road.right - BORDER_X;
+	for (int x = 0; x < width; x++) {
+		if (x < left || x >= right) {
+			cells[x].Char.UnicodeChar = PIXEL_SOLID;
+			cells[x].Attributes = FG_DARK_GREEN;
+		} else if (x == left || x == right - 1) {
+			cells[x].Char.UnicodeChar = PIXEL_SOLID;
+			cells[x].Attributes = FG_WHITE;
+		}
+	}
+
+	if (dash <= 8) {
+		for (int lane = 1; lane < road.lanes; lane++) {
+			int x = left + (right - left) * lane / road.lanes;
+			cells[x].Char.UnicodeChar = PIXEL_SOLID;
+			cells[x].Attributes = FG_DARK_YELLOW;
+		}
+	}
+}
+
+Rect Game::RoadAt(int y, int height) {
+	if (pTrack == nullptr)
+		return *pBorder;
+
+	// Screen row y shows track row roadDistance - y
+	int left = BORDER_X;
+	int right = BORDER_X + BORDER_WIDTH;
+	for (int j = y; j < y + height; j++) {
+		TrackRow road = pTrack->Row(roadDistance - j);
+		left = std::max(left, road.left);
+		right = std::min(right, road.right);
 	}
 
-	k++;
-	if (k == 8) k = 0;
+	return Rect(left - 1, BORDER_Y, right - left + 2, BORDER_HEIGHT);
 }
 
 void Game::TitleScreen(){
 	//FillRainbow();
 	pTitleFont->DrawString(this, "RACING GAME", 30, SCREEN_HEIGHT / 2);
-	UpdateScreen();
 }
@@ -1,7 +1,14 @@
 #pragma once
 #include "ConsoleGameEngine.h"
+#include "AssetCache.h"
 #include "Car.h"
+#include "DrawList.h"
+#include "ScreenLayer.h"
+#include "ScrollingBackground.h"
+#include "Track.h"
+#include "PerspectiveRoad.h"
 #include "font.h"
+#include "Hud.h"
 
 // numbers of NPC to be render at the same time
 const int NPC = 5;
@@ -23,9 +30,35 @@ const int MENU_Y			= 0;
 const int MENU_WIDTH		= SCREEN_WIDTH - BORDER_WIDTH;
 const int MENU_HEIGHT		= SCREEN_HEIGHT;
 
+// The player's car leans this many SPRITE_ANGLE_STEPS into a lane change,
+// and spins for CRASH_SPIN_TIME seconds after hitting an NPC
+const int CAR_TILT_STEPS	= 1;
+const float CRASH_SPIN_TIME	= 0.6f;
+
+const wchar_t PLAYER_SPRITE[]	= L"assets/cars/car2.spr";
+const wchar_t NPC_SPRITE[]		= L"assets/cars/car1.spr";
+
+// Tunables of a game session. The defaults are the regular game, the batch
+// simulation varies them to compare traffic densities and speed curves
+// Stored in recorded input logs, a replay runs with the settings it was
+// recorded with whatever the command line says
+struct GameConfig {
+	// numbers of NPC on the road at the same time
+	int nNpc = NPC;
+	// seconds between two NPC steps at the start of a run
+	float fDelay = 0.005f;
+	// the step delay is divided by (1 + fSpeedUp * score), 0 keeps it constant
+	float fSpeedUp = 0.0f;
+	int nMaxSpeed = 4;
+	// lays out a winding road from this seed, 0 keeps the straight one
+	unsigned int nTrackSeed = 0;
+	// draw the road in perspective from behind the player instead of from above
+	bool bPerspective = false;
+};
+
 class Game : public ConsoleGameEngine {
 public:
-	Game();
+	Game(const GameConfig& config = GameConfig());
 
 protected:
 	bool OnUserCreate() override;
@@ -36,25 +69,61 @@ public:
 	void ClearScreen();
 	void UpdateScreen();
 	void FillRainbow();
-	void WaitKey(int vKey);
 	void FillGrid();
 	void DrawBorder();
-	void DrawLine();
+	void RoadRow(long row, CHAR_INFO* cells, int width);
+
+	// The part of the border taken up by road over screen rows y to
+	// y + height - 1, with the border's margin of one column either side
+	Rect RoadAt(int y, int height);
 
 	void Spawn(Car* car);
 	void RandomizeNPC();
 	void TitleScreen();
-	
+
+	// Title screen with a progress bar, shown until every asset is in
+	void UpdateLoading(float fElapsedTime);
+	void CreateCars(std::shared_ptr<const Sprite> playerSprite, std::shared_ptr<const Sprite> npcSprite);
+	void CreateHud();
+
+	void UpdateWorld(float fElapsedTime);
+	void DrawWorld();
+
+	// Read-only view of the session for bots and statistics
+	const Rect& Border() const;
+	const Car& Player() const;
+	int NpcCount() const;
+	const Car& Npc(int i) const;
+	int Score() const;
+	int Speed() const;
+	float TimeSinceStart() const;
+	bool IsGameOver() const;
 
 private:
+	GameConfig config;
+
 	Rect* pBorder;
 	Car* pPlayer;
 
-	Car* pNpc[NPC];
+	std::vector<Car*> pNpc;
 
 	Font* pFont;
 	Font* pTitleFont;
 
+	// Score panel right of the road, redrawn only where a value changed
+	HudPanel* pHud;
+	ScrollingBackground* pRoad;
+	Track* pTrack;
+	PerspectiveRoad* pPerspective;
+	DrawList drawList;
+
+	// Assets still streaming in, see OnUserCreate()
+	AssetCache::SpriteFuture playerSpriteFuture;
+	AssetCache::SpriteFuture npcSpriteFuture;
+	std::future<std::unique_ptr<Font>> fontFuture;
+	std::future<std::unique_ptr<Font>> titleFontFuture;
+	std::future<AudioSample> hitSoundFuture;
+
 private:
 	int score;
 	int highScore;
@@ -64,5 +133,14 @@ private:
 	float timeSinceStart;
 	int hitSoundEffect;
 
+	// Rows the road has moved down so far
+	long roadDistance;
+
+	// Assets().Generation() the cars last took their sprites at
+	unsigned int assetGeneration;
+
 	bool gameOver;
+	float crashTime;
+	bool loading;
+	float loadingTime;
 };
\ No newline at end of file
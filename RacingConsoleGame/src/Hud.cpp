@@ -0,0 +1,118 @@
+#include "Hud.h"
+#include "AssetCache.h"
+#include <algorithm>
+
+HudWidget::HudWidget(int height) {
+	this->height = height;
+}
+
+HudWidget::~HudWidget() {
+}
+
+int HudWidget::Height() const {
+	return height;
+}
+
+HudLabel::HudLabel(Font* font, const std::string& text) : HudWidget(font->Height()) {
+	this->font = font;
+	this->text = text;
+}
+
+bool HudLabel::Changed() const {
+	return false;
+}
+
+void HudLabel::Draw(ConsoleGameEngine* engine, int x, int y, int width) {
+	font->DrawString(engine, text, x, y);
+}
+
+HudCounter::HudCounter(Font* font, const std::string& label, const int* value) : HudWidget(font->Height()) {
+	this->font = font;
+	this->label = label;
+	this->value = value;
+	this->shown = *value;
+}
+
+bool HudCounter::Changed() const {
+	return *value != shown;
+}
+
+void HudCounter::Draw(ConsoleGameEngine* engine, int x, int y, int width) {
+	shown = *value;
+	font->DrawString(engine, label, x, y);
+	font->DrawString(engine, std::to_string(shown), font->GetLastPosition());
+}
+
+HudBar::HudBar(const int* value, int maxValue, int barWidth, int barHeight, short colour) : HudWidget(barHeight) {
+	this->value = value;
+	this->maxValue = maxValue;
+	this->barWidth = barWidth;
+	this->colour = colour;
+	this->shown = *value;
+}
+
+bool HudBar::Changed() const {
+	return *value != shown;
+}
+
+void HudBar::Draw(ConsoleGameEngine* engine, int x, int y, int width) {
+	shown = *value;
+
+	int w = std::min(barWidth, width);
+	int filled = maxValue > 0 ? w * std::max(0, std::min(shown, maxValue)) / maxValue : 0;
+	engine->Fill(x, y, x + w, y + Height(), PIXEL_SOLID, FG_DARK_GREY);
+	engine->Fill(x, y, x + filled, y + Height(), PIXEL_SOLID, colour);
+}
+
+HudPanel::HudPanel(const Rect& area, int marginX, int marginY, int spacing, short background) {
+	this->area = area;
+	this->marginX = marginX;
+	this->marginY = marginY;
+	this->spacing = spacing;
+	this->background = background;
+	this->invalid = true;
+	this->assetGeneration = 0;
+}
+
+void HudPanel::Add(std::unique_ptr<HudWidget> widget) {
+	widgets.push_back(std::move(widget));
+	invalid = true;
+}
+
+void HudPanel::Invalidate() {
+	invalid = true;
+}
+
+void HudPanel::Draw(ConsoleGameEngine* engine) {
+	int x1 = area.Left();
+	int x2 = area.Right() + 1;
+
+	// A reloaded font changes how even unchanged values look
+	if (assetGeneration != engine->Assets().Generation()) {
+		assetGeneration = engine->Assets().Generation();
+		invalid = true;
+	}
+
+	// A widget too wide or tall for the panel is cut off at its edges
+	engine->PushClip(x1, area.Top(), x2, area.Bottom() + 1);
+
+	if (invalid) {
+		engine->Fill(x1, area.Top(), x2, area.Bottom() + 1, PIXEL_BLANK, background);
+		engine->MarkDirty(x1, area.Top(), x2, area.Bottom() + 1);
+	}
+
+	int y = area.Top() + marginY;
+	for (auto& widget : widgets) {
+		if (invalid || widget->Changed()) {
+			// The row spans the panel, a shorter value must not leave digits behind
+			engine->Fill(x1, y, x2, y + widget->Height(), PIXEL_BLANK, background);
+			widget->Draw(engine, x1 + marginX, y, area.Width() - 2 * marginX);
+			if (!invalid)
+				engine->MarkDirty(x1, y, x2, y + widget->Height());
+		}
+		y += widget->Height() + spacing;
+	}
+
+	engine->PopClip();
+	invalid = false;
+}
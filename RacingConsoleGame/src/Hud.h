@@ -0,0 +1,101 @@
+#pragma once
+#include "ConsoleGameEngine.h"
+#include "Rect.h"
+#include "font.h"
+#include <string>
+#include <vector>
+#include <memory>
+
+// Retained widgets for the panel next to the road. A widget is bound to the
+// value it shows and is only redrawn, and its cells only presented, when
+// that value changed since it was last drawn.
+class HudWidget {
+public:
+	HudWidget(int height);
+	virtual ~HudWidget();
+
+	int Height() const;
+
+	// True when the bound value differs from the one last drawn
+	virtual bool Changed() const = 0;
+
+	// Draw into a cleared row of the panel and remember the values shown
+	virtual void Draw(ConsoleGameEngine* engine, int x, int y, int width) = 0;
+
+private:
+	int height;
+};
+
+class HudLabel : public HudWidget {
+public:
+	HudLabel(Font* font, const std::string& text);
+
+	bool Changed() const override;
+	void Draw(ConsoleGameEngine* engine, int x, int y, int width) override;
+
+private:
+	Font* font;
+	std::string text;
+};
+
+// A label followed by the current value of an int
+class HudCounter : public HudWidget {
+public:
+	HudCounter(Font* font, const std::string& label, const int* value);
+
+	bool Changed() const override;
+	void Draw(ConsoleGameEngine* engine, int x, int y, int width) override;
+
+private:
+	Font* font;
+	std::string label;
+	const int* value;
+	int shown;
+};
+
+// A bar filled in proportion to an int between 0 and maxValue
+class HudBar : public HudWidget {
+public:
+	HudBar(const int* value, int maxValue, int barWidth, int barHeight, short colour);
+
+	bool Changed() const override;
+	void Draw(ConsoleGameEngine* engine, int x, int y, int width) override;
+
+private:
+	const int* value;
+	int maxValue;
+	int barWidth;
+	short colour;
+	int shown;
+};
+
+// Lays its widgets out top down inside area and draws the changed ones.
+// Nothing outside the panel is touched, so the rest of the screen can be
+// cleared and presented without it
+class HudPanel {
+public:
+	// The first widget goes marginX, marginY from the top left of area, the
+	// others follow spacing rows apart
+	HudPanel(const Rect& area, int marginX, int marginY, int spacing, short background);
+
+	void Add(std::unique_ptr<HudWidget> widget);
+
+	// Redraw the whole panel on the next Draw(), e.g. after something
+	// else has drawn over it
+	void Invalidate();
+
+	// Also redraws everything once reloaded assets may have changed how
+	// the widgets look
+	void Draw(ConsoleGameEngine* engine);
+
+private:
+	Rect area;
+	int marginX;
+	int marginY;
+	int spacing;
+	short background;
+	bool invalid;
+	unsigned int assetGeneration;
+
+	std::vector<std::unique_ptr<HudWidget>> widgets;
+};
@@ -0,0 +1,175 @@
+#include "InputLog.h"
+#include "ConsoleGameEngine.h"
+
+namespace {
+	const char LOG_MAGIC[4] = {'R', 'C', 'G', 'I'};
+	const unsigned int LOG_VERSION = 3;
+
+	// Settings are capped so a damaged header cannot ask for anything large
+	const unsigned int MAX_SETTINGS = 4096;
+
+	// Per frame flags, tell which blocks follow the elapsed time
+	const unsigned char FRAME_KEYS = 0x01;
+	const unsigned char FRAME_MOUSE = 0x02;
+	const unsigned char FRAME_MOUSE_POS = 0x04;
+	const unsigned char FRAME_FOCUSED = 0x08;
+}
+
+InputLog::InputLog() {
+	m_file = nullptr;
+	m_bWriting = false;
+	m_nSeed = 0;
+	m_nFrames = 0;
+}
+
+InputLog::~InputLog() {
+	Close();
+}
+
+bool InputLog::OpenWrite(std::wstring sFile) {
+	Close();
+
+	_wfopen_s(&m_file, sFile.c_str(), L"wb");
+	if (m_file == nullptr)
+		return false;
+
+	m_bWriting = true;
+	m_last = sInputFrame();
+	return true;
+}
+
+bool InputLog::OpenRead(std::wstring sFile) {
+	Close();
+
+	_wfopen_s(&m_file, sFile.c_str(), L"rb");
+	if (m_file == nullptr)
+		return false;
+
+	char magic[4];
+	unsigned int version = 0;
+	std::fread(magic, sizeof(char), 4, m_file);
+	std::fread(&version, sizeof(unsigned int), 1, m_file);
+	if (strncmp(magic, LOG_MAGIC, 4) != 0 || version < 2 || version > LOG_VERSION) {
+		Close();
+		return false;
+	}
+
+	std::fread(&m_nSeed, sizeof(unsigned int), 1, m_file);
+
+	// v2 logs stop at the seed
+	m_vecSettings.clear();
+	if (version >= 3) {
+		unsigned int nSize = 0;
+		if (std::fread(&nSize, sizeof(unsigned int), 1, m_file) != 1 || nSize > MAX_SETTINGS) {
+			Close();
+			return false;
+		}
+		m_vecSettings.resize(nSize);
+		if (std::fread(m_vecSettings.data(), sizeof(char), nSize, m_file) != nSize) {
+			Close();
+			return false;
+		}
+	}
+
+	m_bWriting = false;
+	m_last = sInputFrame();
+	return true;
+}
+
+void InputLog::Close() {
+	if (m_file != nullptr)
+		std::fclose(m_file);
+	m_file = nullptr;
+	m_bWriting = false;
+	m_nFrames = 0;
+}
+
+bool InputLog::IsRecording() const {
+	return m_file != nullptr && m_bWriting;
+}
+
+bool InputLog::IsReplaying() const {
+	return m_file != nullptr && !m_bWriting;
+}
+
+void InputLog::WriteHeader(unsigned int nSeed, const std::vector<char>& settings) {
+	if (!IsRecording())
+		return;
+
+	m_nSeed = nSeed;
+	m_vecSettings = settings;
+	unsigned int nSize = (unsigned int) m_vecSettings.size();
+	std::fwrite(LOG_MAGIC, sizeof(char), 4, m_file);
+	std::fwrite(&LOG_VERSION, sizeof(unsigned int), 1, m_file);
+	std::fwrite(&m_nSeed, sizeof(unsigned int), 1, m_file);
+	std::fwrite(&nSize, sizeof(unsigned int), 1, m_file);
+	std::fwrite(m_vecSettings.data(), sizeof(char), nSize, m_file);
+}
+
+void InputLog::WriteFrame(const sInputFrame& frame) {
+	if (!IsRecording())
+		return;
+
+	unsigned char flags = 0;
+	if (memcmp(frame.keys, m_last.keys, sizeof(frame.keys)) != 0)
+		flags |= FRAME_KEYS;
+	if (frame.mouse != m_last.mouse)
+		flags |= FRAME_MOUSE;
+	if (frame.mousePosX != m_last.mousePosX || frame.mousePosY != m_last.mousePosY)
+		flags |= FRAME_MOUSE_POS;
+	if (frame.bFocused)
+		flags |= FRAME_FOCUSED;
+
+	std::fwrite(&flags, sizeof(unsigned char), 1, m_file);
+	std::fwrite(&frame.fElapsedTime, sizeof(float), 1, m_file);
+	if (flags & FRAME_KEYS)
+		std::fwrite(frame.keys, sizeof(unsigned char), sizeof(frame.keys), m_file);
+	if (flags & FRAME_MOUSE)
+		std::fwrite(&frame.mouse, sizeof(unsigned char), 1, m_file);
+	if (flags & FRAME_MOUSE_POS) {
+		std::fwrite(&frame.mousePosX, sizeof(short), 1, m_file);
+		std::fwrite(&frame.mousePosY, sizeof(short), 1, m_file);
+	}
+
+	m_last = frame;
+	m_nFrames++;
+}
+
+bool InputLog::ReadFrame(sInputFrame& frame) {
+	if (!IsReplaying())
+		return false;
+
+	unsigned char flags = 0;
+	if (std::fread(&flags, sizeof(unsigned char), 1, m_file) != 1)
+		return false;
+
+	// Everything not stored in this frame carries over from the last one
+	frame = m_last;
+	if (std::fread(&frame.fElapsedTime, sizeof(float), 1, m_file) != 1)
+		return false;
+	if (flags & FRAME_KEYS)
+		std::fread(frame.keys, sizeof(unsigned char), sizeof(frame.keys), m_file);
+	if (flags & FRAME_MOUSE)
+		std::fread(&frame.mouse, sizeof(unsigned char), 1, m_file);
+	if (flags & FRAME_MOUSE_POS) {
+		std::fread(&frame.mousePosX, sizeof(short), 1, m_file);
+		std::fread(&frame.mousePosY, sizeof(short), 1, m_file);
+	}
+	frame.bFocused = (flags & FRAME_FOCUSED) != 0;
+
+	m_last = frame;
+	m_nFrames++;
+	return true;
+}
+
+unsigned int InputLog::Seed() const {
+	return m_nSeed;
+}
+
+const std::vector<char>& InputLog::Settings() const {
+	return m_vecSettings;
+}
+
+long InputLog::Frames() const {
+	return m_nFrames;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include "InputSource.h"
+#include <string>
+#include <vector>
+#include <cstdio>
+
+// Binary log of sInputFrame's. The file starts with a small header holding
+// the random seed of the session and the game's own settings, opaque bytes
+// to the log, then every frame is stored as a flag byte
+// followed by the elapsed time and only the parts that changed since the
+// previous frame. A typical frame costs 5 bytes. A log opened for reading
+// is an InputSource, so it can drive an engine in place of the console.
+class InputLog : public InputSource {
+public:
+	InputLog();
+	~InputLog();
+
+	bool OpenWrite(std::wstring sFile);
+	bool OpenRead(std::wstring sFile);
+	void Close();
+
+	bool IsRecording() const;
+	bool IsReplaying() const;
+
+	// Only valid for a log opened for writing, must be called once before
+	// the first frame is written
+	void WriteHeader(unsigned int nSeed, const std::vector<char>& settings);
+	void WriteFrame(const sInputFrame& frame);
+
+	// Returns false once the end of the log has been reached
+	bool ReadFrame(sInputFrame& frame) override;
+
+	unsigned int Seed() const;
+	// Empty for logs written before settings were stored
+	const std::vector<char>& Settings() const;
+	long Frames() const;
+
+private:
+	FILE* m_file;
+	bool m_bWriting;
+	unsigned int m_nSeed;
+	std::vector<char> m_vecSettings;
+	long m_nFrames;
+	sInputFrame m_last;
+};
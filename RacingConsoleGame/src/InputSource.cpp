@@ -0,0 +1,87 @@
+#include "InputSource.h"
+
+bool sInputFrame::GetKey(int nKeyID) const {
+	return (keys[(nKeyID & 0xFF) >> 3] & (1 << (nKeyID & 7))) != 0;
+}
+
+void sInputFrame::SetKey(int nKeyID, bool bHeld) {
+	if (bHeld)
+		keys[(nKeyID & 0xFF) >> 3] |= (1 << (nKeyID & 7));
+	else
+		keys[(nKeyID & 0xFF) >> 3] &= ~(1 << (nKeyID & 7));
+}
+
+bool sInputFrame::GetMouse(int nMouseButtonID) const {
+	return (mouse & (1 << nMouseButtonID)) != 0;
+}
+
+void sInputFrame::SetMouse(int nMouseButtonID, bool bHeld) {
+	if (bHeld)
+		mouse |= (1 << nMouseButtonID);
+	else
+		mouse &= ~(1 << nMouseButtonID);
+}
+
+ConsoleInput::ConsoleInput() {
+	m_hConsoleIn = GetStdHandle(STD_INPUT_HANDLE);
+}
+
+ConsoleInput::ConsoleInput(HANDLE hConsoleIn) {
+	m_hConsoleIn = hConsoleIn;
+}
+
+bool ConsoleInput::ReadFrame(sInputFrame& frame) {
+	// Handle Mouse Input - Check for window events
+	INPUT_RECORD inBuf[32];
+	DWORD events = 0;
+	GetNumberOfConsoleInputEvents(m_hConsoleIn, &events);
+	if (events > 0)
+		ReadConsoleInput(m_hConsoleIn, inBuf, events, &events);
+
+	// Handle events - we only care about mouse clicks and movement
+	// for now
+	for (DWORD i = 0; i < events; i++) {
+		switch (inBuf[i].EventType) {
+			case FOCUS_EVENT:
+			{
+				frame.bFocused = inBuf[i].Event.FocusEvent.bSetFocus;
+			}
+			break;
+
+			case MOUSE_EVENT:
+			{
+				switch (inBuf[i].Event.MouseEvent.dwEventFlags) {
+					case MOUSE_MOVED:
+					{
+						frame.mousePosX = inBuf[i].Event.MouseEvent.dwMousePosition.X;
+						frame.mousePosY = inBuf[i].Event.MouseEvent.dwMousePosition.Y;
+					}
+					break;
+
+					case 0:
+					{
+						for (int m = 0; m < 5; m++)
+							frame.SetMouse(m, (inBuf[i].Event.MouseEvent.dwButtonState & (1 << m)) > 0);
+
+					}
+					break;
+
+					default:
+						break;
+				}
+			}
+			break;
+
+			default:
+				break;
+				// We don't care just at the moment
+		}
+	}
+
+	// Handle Keyboard Input, the key state is shared by the whole desktop so
+	// only take it while this console has the focus
+	for (int i = 0; i < 256; i++)
+		frame.SetKey(i, frame.bFocused && (GetAsyncKeyState(i) & 0x8000) != 0);
+
+	return true;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <windows.h>
+
+// One frame worth of input as the engine sees it. Keys and mouse buttons are
+// stored as "held" bits only, the pressed/released edges are derived from two
+// consecutive frames, so a replayed frame produces exactly the same m_keys[].
+struct sInputFrame {
+	float fElapsedTime = 0.0f;
+	unsigned char keys[32] = {0};
+	unsigned char mouse = 0;
+	short mousePosX = 0;
+	short mousePosY = 0;
+	bool bFocused = true;
+
+	bool GetKey(int nKeyID) const;
+	void SetKey(int nKeyID, bool bHeld);
+
+	bool GetMouse(int nMouseButtonID) const;
+	void SetMouse(int nMouseButtonID, bool bHeld);
+};
+
+// Where an engine instance gets its input from. The engine calls ReadFrame()
+// once per frame with fElapsedTime already set from its own clock, a source
+// may overwrite it (a replay does). Returning false stops the engine.
+class InputSource {
+public:
+	virtual ~InputSource() {}
+
+	virtual bool ReadFrame(sInputFrame& frame) = 0;
+};
+
+// Live keyboard and mouse of a console. While the console does not have the
+// focus all keys read as released, so an engine only reacts to keystrokes
+// that were meant for it.
+class ConsoleInput : public InputSource {
+public:
+	ConsoleInput();
+	ConsoleInput(HANDLE hConsoleIn);
+
+	bool ReadFrame(sInputFrame& frame) override;
+
+private:
+	HANDLE m_hConsoleIn;
+};
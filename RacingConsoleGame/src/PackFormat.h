@@ -0,0 +1,60 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cwctype>
+#include <string>
+
+// On-disk layout of an asset pack, shared by the game and the AssetPacker tool.
+//
+//   sPackHeader
+//   sPackEntry[nEntries]     sorted by nHash
+//   payloads                 each starting on a PACK_ALIGN boundary
+//
+// Payloads are the asset files, sprites converted to the v2 format of
+// SpriteFormat.h and sounds as the unmodified .wav file. PACK_ALIGN keeps the
+// cells of a v2 sprite as aligned in the mapping as they are in the file.
+// Names are not stored, the packer refuses to build a pack where two names
+// hash the same.
+
+const char PACK_MAGIC[4] = {'R', 'C', 'G', 'P'};
+const uint32_t PACK_VERSION = 1;
+const uint32_t PACK_ALIGN = 16;
+
+enum PACK_ASSET_TYPE : uint16_t {
+	PACK_SPRITE = 1,
+	PACK_SOUND = 2,
+};
+
+struct sPackHeader {
+	char magic[4];
+	uint32_t nVersion;
+	uint32_t nEntries;
+	uint32_t nReserved;
+};
+
+struct sPackEntry {
+	uint32_t nHash;
+	uint16_t nType;
+	uint16_t nReserved;
+	uint32_t nOffset;		// from the start of the pack
+	uint32_t nSize;
+};
+
+static_assert(sizeof(sPackHeader) == 16, "pack header layout changed");
+static_assert(sizeof(sPackEntry) == 16, "pack entry layout changed");
+
+// FNV-1a over the name with case folded and '\' turned into '/', so
+// L"assets\\Cars\\car1.spr" and L"assets/cars/car1.spr" find the same entry
+inline uint32_t PackHash(const std::wstring& sName) {
+	uint32_t nHash = 2166136261u;
+	for (wchar_t c : sName) {
+		if (c == L'\\')
+			c = L'/';
+		else
+			c = (wchar_t) towlower(c);
+
+		nHash ^= (uint32_t) c;
+		nHash *= 16777619u;
+	}
+	return nHash;
+}
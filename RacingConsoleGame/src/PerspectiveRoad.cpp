@@ -0,0 +1,146 @@
+#include "PerspectiveRoad.h"
+#include <algorithm>
+
+namespace {
+	// Rows ahead at which things are drawn at half their size
+	const float HALF_SIZE_DISTANCE = 24.0f;
+	const float MAX_DISTANCE = 600.0f;
+
+	const int POST_SPACING = 24;
+	const int POST_WIDTH = 2;
+	const int POST_HEIGHT = 10;
+}
+
+PerspectiveRoad::PerspectiveRoad(const Rect& view, int stripWidth) {
+	this->view = view;
+	this->stripWidth = stripWidth;
+	horizon = view.Top() + view.Height() / 4;
+
+	// Full size on the bottom row, shrinking towards the horizon
+	int depth = view.Bottom() - horizon;
+	rows.resize(view.Height());
+	for (int y = view.Top(); y <= view.Bottom(); y++) {
+		RowProjection& row = rows[y - view.Top()];
+		if (y <= horizon) {
+			row.distance = MAX_DISTANCE;
+			row.scale = 0.0f;
+			continue;
+		}
+
+		row.scale = (float) (y - horizon) / depth;
+		row.distance = std::min(HALF_SIZE_DISTANCE / row.scale - HALF_SIZE_DISTANCE, MAX_DISTANCE);
+	}
+}
+
+int PerspectiveRoad::RowAt(float distance) const {
+	if (distance < 0.0f || distance >= MAX_DISTANCE)
+		return -1;
+
+	float scale = ScaleAt(distance);
+	return horizon + (int) (scale * (view.Bottom() - horizon) + 0.5f);
+}
+
+float PerspectiveRoad::ScaleAt(float distance) const {
+	return HALF_SIZE_DISTANCE / (distance + HALF_SIZE_DISTANCE);
+}
+
+void PerspectiveRoad::Draw(ConsoleGameEngine* engine, Track* track, long roadDistance, const Car& player, const std::vector<Car*>& npcs) {
+	engine->PushClip(view.Left(), view.Top(), view.Right() + 1, view.Bottom() + 1);
+	sScreenRect clip = engine->ClipRect();
+	int centreX = view.Left() + view.Width() / 2;
+	float cameraX = player.Left() + player.Width() / 2.0f;
+
+	// Top-down screen row y shows track row roadDistance - y, the player's
+	// nose is distance 0
+	long playerRow = roadDistance - player.Top();
+
+	engine->FillIn(clip, clip.x1, clip.y1, clip.x2, horizon + 1, PIXEL_SOLID, FG_DARK_BLUE);
+
+	for (int y = horizon + 1; y <= view.Bottom(); y++) {
+		const RowProjection& projection = rows[y - view.Top()];
+		long row = playerRow + (long) projection.distance;
+
+		int left = 1;
+		int right = stripWidth - 1;
+		int lanes = 2;
+		if (track != nullptr) {
+			TrackRow road = track->Row(row);
+			left = road.left;
+			right = road.right;
+			lanes = road.lanes;
+		}
+
+		// Everything on the row is a span, columns in the strip scale
+		// about the camera
+		auto ScreenX = [&] (float x) { return centreX + (int) ((x - cameraX) * projection.scale + (x >= cameraX ? 0.5f : -0.5f)); };
+		int roadLeft = ScreenX((float) left);
+		int roadRight = ScreenX((float) right);
+		int rumble = std::max(1, (int) (2.0f * projection.scale + 0.5f));
+
+		long band = row < 0 ? -row : row;
+		short grass = (band / 8) % 2 ? FG_GREEN : FG_DARK_GREEN;
+		short kerb = (band / 4) % 2 ? FG_RED : FG_WHITE;
+
+		engine->FillIn(clip, clip.x1, y, clip.x2, y + 1, PIXEL_SOLID, grass);
+		engine->FillIn(clip, roadLeft - rumble, y, roadRight + rumble, y + 1, PIXEL_SOLID, kerb);
+		engine->FillIn(clip, roadLeft, y, roadRight, y + 1, PIXEL_SOLID, FG_DARK_GREY);
+
+		if (band % 16 <= 8) {
+			int marking = std::max(1, (int) (2.0f * projection.scale + 0.5f));
+			for (int lane = 1; lane < lanes; lane++) {
+				int x = ScreenX(left + (right - left) * lane / (float) lanes);
+				engine->FillIn(clip, x - marking / 2, y, x - marking / 2 + marking, y + 1, PIXEL_SOLID, FG_YELLOW);
+			}
+		}
+	}
+
+	// Posts along both sides, furthest first so nearer ones cover them
+	long firstPost = (playerRow + (long) MAX_DISTANCE) / POST_SPACING * POST_SPACING;
+	for (long row = firstPost; row >= playerRow; row -= POST_SPACING) {
+		float distance = (float) (row - playerRow);
+		int y = RowAt(distance);
+		if (y < 0)
+			continue;
+
+		int left = 1;
+		int right = stripWidth - 1;
+		if (track != nullptr) {
+			TrackRow road = track->Row(row);
+			left = road.left;
+			right = road.right;
+		}
+
+		float scale = ScaleAt(distance);
+		int width = std::max(1, (int) (POST_WIDTH * scale + 0.5f));
+		int height = std::max(1, (int) (POST_HEIGHT * scale + 0.5f));
+		for (float x : {left - 4.0f, right + 2.0f}) {
+			int sx = centreX + (int) ((x - cameraX) * scale);
+			engine->FillIn(clip, sx, y - height, sx + width, y, PIXEL_SOLID, FG_WHITE);
+		}
+	}
+
+	// Cars ahead of the player, then the player itself in front
+	visible.clear();
+	for (const Car* npc : npcs) {
+		float distance = (float) (player.Top() - npc->Top());
+		if (distance > 0.0f && distance < MAX_DISTANCE)
+			visible.push_back({distance, npc});
+	}
+	std::sort(visible.begin(), visible.end(), [] (const VisibleCar& a, const VisibleCar& b) { return a.distance > b.distance; });
+	visible.push_back({0.0f, &player});
+
+	for (const VisibleCar& v : visible) {
+		const Sprite* sprite = v.car->GetSprite();
+		if (sprite == nullptr)
+			continue;
+
+		float scale = ScaleAt(v.distance);
+		int width = std::max(1, (int) (sprite->nWidth * scale + 0.5f));
+		int height = std::max(1, (int) (sprite->nHeight * scale + 0.5f));
+		int x = centreX + (int) ((v.car->Left() - cameraX) * scale);
+		int y = std::min(RowAt(v.distance), view.Bottom()) - height + 1;
+		engine->DrawSpriteScaledIn(clip, x, y, width, height, sprite);
+	}
+
+	engine->PopClip();
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include "ConsoleGameEngine.h"
+#include "Rect.h"
+#include "Car.h"
+#include "Track.h"
+#include <vector>
+
+// The top-down road seen from just behind the player, in the style of the
+// old arcade racers. What each screen row shows is worked out once: how far
+// ahead it looks and how much it shrinks things. A frame is then one span
+// fill after another per row for grass, rumble strips, tarmac and lane
+// markings, with the cars and roadside posts scaled to the row they stand
+// on and drawn far to near.
+class PerspectiveRoad {
+public:
+	// view is the part of the screen drawn on, stripWidth the width in
+	// cells of the top-down strip the road runs in
+	PerspectiveRoad(const Rect& view, int stripWidth);
+
+	// track may be nullptr for the straight road. roadDistance is how far
+	// the road has scrolled, as in Game. Nothing is drawn outside view or
+	// the engine's current clip
+	void Draw(ConsoleGameEngine* engine, Track* track, long roadDistance, const Car& player, const std::vector<Car*>& npcs);
+
+private:
+	struct RowProjection {
+		float distance;		// rows ahead of the player in the top-down game
+		float scale;		// screen cells per top-down cell
+	};
+
+	// Screen row showing distance rows ahead, or -1 beyond the horizon
+	int RowAt(float distance) const;
+	float ScaleAt(float distance) const;
+
+	Rect view;
+	int stripWidth;
+	int horizon;
+	std::vector<RowProjection> rows;
+
+	struct VisibleCar {
+		float distance;
+		const Car* car;
+	};
+	std::vector<VisibleCar> visible;
+};
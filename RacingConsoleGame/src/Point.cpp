@@ -39,12 +39,12 @@ void Point::SetY(int y) {
 	this->y = y;
 }
 
-void Point::RandomizeX(int min, int max) {
-	this->x = min + rand() % (max - min);
+void Point::RandomizeX(int min, int max, std::minstd_rand& random) {
+	this->x = min + (int) (random() % (max - min));
 }
 
-void Point::RandomizeY(int min, int max) {
-	this->y = min + rand() % (max - min);
+void Point::RandomizeY(int min, int max, std::minstd_rand& random) {
+	this->y = min + (int) (random() % (max - min));
 }
 
 int Point::GetX() const {
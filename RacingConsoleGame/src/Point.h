@@ -24,8 +24,8 @@ public:
 	void SetX(int x);
 	void SetY(int y);
 
-	void RandomizeX(int min, int max);
-	void RandomizeY(int min, int max);
+	void RandomizeX(int min, int max, std::minstd_rand& random);
+	void RandomizeY(int min, int max, std::minstd_rand& random);
 
 	int GetX() const;
 	int GetY() const;
@@ -0,0 +1,83 @@
+#include "RasterBenchmark.h"
+#include "ThreadPool.h"
+#include <chrono>
+#include <thread>
+#include <cstring>
+
+RasterBenchmark::RasterBenchmark(int nWidth, int nHeight) {
+	m_sAppName = L"Raster Benchmark";
+	ConstructHeadless(nWidth, nHeight);
+}
+
+bool RasterBenchmark::OnUserCreate() {
+	return true;
+}
+
+bool RasterBenchmark::OnUserUpdate(float fElapsedTime) {
+	return true;
+}
+
+void RasterBenchmark::RecordScene() {
+	carSprite = Assets().LoadSprite(L"assets/cars/car2.spr");
+	npcSprite = Assets().LoadSprite(L"assets/cars/car1.spr");
+
+	int w = ScreenWidth();
+	int h = ScreenHeight();
+	unsigned int nRandom = 1;
+	auto Next = [&nRandom] (int n) {
+		nRandom = nRandom * 1664525u + 1013904223u;
+		return (int) ((nRandom >> 8) % n);
+	};
+
+	scene.Clear();
+	scene.Fill(LAYER_BACKGROUND, 0, 0, w, h, PIXEL_SOLID, FG_DARK_GREEN);
+
+	// Several roads side by side, each with its lane markings and traffic
+	int nRoadWidth = 100;
+	for (int x = 10; x + nRoadWidth <= w; x += nRoadWidth + 20) {
+		scene.Fill(LAYER_ROAD, x, 0, x + nRoadWidth, h, PIXEL_BLANK, BG_BLACK);
+		for (int y = 0; y < h; y += 16)
+			scene.Fill(LAYER_ROAD, x + nRoadWidth / 2 - 1, y, x + nRoadWidth / 2 + 1, y + 9, PIXEL_SOLID, FG_DARK_YELLOW);
+
+		for (int i = 0; i < h / 4; i++)
+			scene.DrawSprite(LAYER_VEHICLES, x + Next(nRoadWidth - npcSprite->nWidth), Next(h + 40) - 30, npcSprite.get());
+		scene.DrawSprite(LAYER_VEHICLES, x + nRoadWidth / 2, h - 2 * carSprite->nHeight, carSprite.get());
+
+		scene.Fill(LAYER_HUD, x, 0, x + 1, h, PIXEL_BLANK, BG_DARK_RED);
+		scene.Fill(LAYER_HUD, x + nRoadWidth - 1, 0, x + nRoadWidth, h, PIXEL_BLANK, BG_DARK_RED);
+	}
+
+	scene.Finish(w, h);
+}
+
+void RasterBenchmark::Run(int nFrames, unsigned int nMaxThreads, int nTileWidth, int nTileHeight) {
+	if (nMaxThreads == 0)
+		nMaxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+	RecordScene();
+	wprintf(L"Rasterizing %dx%d, %d commands, %dx%d tiles, %d frames\n",
+			ScreenWidth(), ScreenHeight(), (int) scene.Commands().size(), nTileWidth, nTileHeight, nFrames);
+
+	size_t nCells = (size_t) ScreenWidth() * ScreenHeight();
+	auto Time = [&] (std::function<void()> frame) {
+		memset(m_bufScreen, 0, nCells * sizeof(CHAR_INFO));
+		auto tp1 = std::chrono::steady_clock::now();
+		for (int i = 0; i < nFrames; i++)
+			frame();
+		auto tp2 = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::milli>(tp2 - tp1).count() / nFrames;
+	};
+
+	double fSerial = Time([this] { scene.Execute(this); });
+	std::vector<CHAR_INFO> expected(m_bufScreen, m_bufScreen + nCells);
+
+	wprintf(L"%-10s %10s %10s %10s\n", L"threads", L"ms/frame", L"speedup", L"identical");
+	wprintf(L"%-10s %10.3f %10.2f %10s\n", L"serial", fSerial, 1.0, L"-");
+
+	for (unsigned int nThreads = 1; nThreads <= nMaxThreads; nThreads = nThreads < nMaxThreads ? std::min(nThreads * 2, nMaxThreads) : nThreads + 1) {
+		ThreadPool pool(nThreads);
+		double fTiled = Time([&] { scene.ExecuteTiles(this, pool, nTileWidth, nTileHeight); });
+		bool bIdentical = memcmp(expected.data(), m_bufScreen, nCells * sizeof(CHAR_INFO)) == 0;
+		wprintf(L"%-10u %10.3f %10.2f %10s\n", nThreads, fTiled, fSerial / fTiled, bIdentical ? L"yes" : L"NO");
+	}
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "ConsoleGameEngine.h"
+#include "AssetCache.h"
+#include "DrawList.h"
+#include <vector>
+
+// Times DrawList::Execute() against DrawList::ExecuteTiles() on 1 to
+// nMaxThreads threads for a busy road scene, headless, and checks every
+// tiled frame against the serial one.
+class RasterBenchmark : public ConsoleGameEngine {
+public:
+	RasterBenchmark(int nWidth, int nHeight);
+
+	void Run(int nFrames, unsigned int nMaxThreads, int nTileWidth, int nTileHeight);
+
+protected:
+	bool OnUserCreate() override;
+	bool OnUserUpdate(float fElapsedTime) override;
+
+private:
+	void RecordScene();
+
+	DrawList scene;
+	std::shared_ptr<const Sprite> carSprite;
+	std::shared_ptr<const Sprite> npcSprite;
+};
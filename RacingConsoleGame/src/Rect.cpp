@@ -132,6 +132,13 @@ void Rect::DrawSelf(ConsoleGameEngine* engine, short c, short col) const {
 	}
 }
 
+void Rect::DrawSelf(DrawList& list, int nLayer, short c, short col) const {
+	list.Fill(nLayer, Left(), Top(), Right() + 1, Top() + 1, c, col);
+	list.Fill(nLayer, Right(), Top(), Right() + 1, Bottom() + 1, c, col);
+	list.Fill(nLayer, Left(), Bottom(), Right() + 1, Bottom() + 1, c, col);
+	list.Fill(nLayer, Left(), Top(), Left() + 1, Bottom() + 1, c, col);
+}
+
 bool Rect::CollisionWith(const Rect& other) const {
 	if ((x + width - 1) <= other.x)
 		return false;
@@ -1,6 +1,7 @@
 #pragma once
 #include "ConsoleGameEngine.h"
 #include "Point.h"
+#include "DrawList.h"
 
 class Rect : public Point {
 public:
@@ -34,6 +35,7 @@ public:
 	bool OutOfBound(const Rect& boundary);
 
 	void DrawSelf(ConsoleGameEngine* engine, short c, short col) const;
+	void DrawSelf(DrawList& list, int nLayer, short c, short col) const;
 
 	bool CollisionWith(const Rect& other) const;
 };
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include "ScreenLayer.h"
+
+ScreenLayer::ScreenLayer(const std::wstring& sName) {
+	m_sName = sName;
+}
+
+const std::wstring& ScreenLayer::Name() const {
+	return m_sName;
+}
+
+void ScreenLayer::Invalidate() {
+	m_bDirty = true;
+}
+
+bool ScreenLayer::IsDirty() const {
+	return m_bDirty;
+}
+
+int ScreenLayer::Coverage() const {
+	return m_nCoverage;
+}
+
+void ScreenLayer::Reset(int nWidth, int nHeight) {
+	m_nWidth = nWidth;
+	m_nHeight = nHeight;
+	m_cells.assign(nWidth * nHeight, CHAR_INFO());
+	m_coverage.assign(nWidth * nHeight, 0);
+	m_runs.clear();
+	m_rowRuns.clear();
+}
+
+void ScreenLayer::Seal() {
+	m_runs.clear();
+	m_rowRuns.clear();
+	m_nCoverage = 0;
+
+	for (int y = 0; y < m_nHeight; y++) {
+		m_rowRuns.push_back((int32_t) m_runs.size());
+
+		const uint32_t* pRow = m_coverage.data() + y * m_nWidth;
+		int x = 0;
+		while (x < m_nWidth) {
+			if (pRow[x] == 0) {
+				x++;
+				continue;
+			}
+
+			int n = 1;
+			while (x + n < m_nWidth && pRow[x + n] != 0)
+				n++;
+			m_runs.push_back({(int16_t) x, (int16_t) n});
+			m_nCoverage += n;
+			x += n;
+		}
+	}
+	m_rowRuns.push_back((int32_t) m_runs.size());
+
+	// Only needed while drawing
+	std::vector<uint32_t>().swap(m_coverage);
+	m_bDirty = false;
+}
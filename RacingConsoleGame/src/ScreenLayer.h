@@ -0,0 +1,46 @@
+#pragma once
+#include "ConsoleGameEngine.h"
+#include <vector>
+
+// A screen sized sheet of cells drawn once and then kept, see
+// ConsoleGameEngine::BeginLayer(). Cells nothing was drawn on are
+// transparent, whatever glyph and colour the drawn ones hold. After
+// drawing, each row is reduced to its runs of drawn cells, so putting the
+// layer on the screen copies those runs and skips the rest.
+class ScreenLayer {
+public:
+	ScreenLayer(const std::wstring& sName);
+
+	const std::wstring& Name() const;
+
+	// Have the layer drawn again by the next BeginLayer()
+	void Invalidate();
+	bool IsDirty() const;
+
+	// Cells drawn, for a rough idea of what DrawLayer() costs
+	int Coverage() const;
+
+private:
+	friend class ConsoleGameEngine;
+
+	struct sLayerRun {
+		int16_t x;
+		int16_t nLength;
+	};
+
+	// Size the layer and make every cell transparent
+	void Reset(int nWidth, int nHeight);
+
+	// Build the runs from what was drawn and mark the layer clean
+	void Seal();
+
+	std::wstring m_sName;
+	bool m_bDirty = true;
+	int m_nWidth = 0;
+	int m_nHeight = 0;
+	std::vector<CHAR_INFO> m_cells;
+	std::vector<uint32_t> m_coverage;	// 0xFFFFFFFF for cells drawn on, until Seal()
+	std::vector<sLayerRun> m_runs;
+	std::vector<int32_t> m_rowRuns;		// first run of each row, nHeight + 1 entries
+	int m_nCoverage = 0;
+};
@@ -0,0 +1,54 @@
+#include "ScrollingBackground.h"
+
+ScrollingBackground::ScrollingBackground(int nWidth, int nHeight, ROW_GENERATOR generator) {
+	m_nWidth = nWidth;
+	m_nHeight = nHeight;
+	m_generator = generator;
+	m_cells.resize(nWidth * nHeight);
+}
+
+void ScrollingBackground::Scroll(int nRows) {
+	if (nRows < 0)
+		nRows = 0;
+
+	if (!m_bValid || nRows >= m_nHeight) {
+		m_nTop += nRows;
+		for (int j = 0; j < m_nHeight; j++)
+			Generate(m_nTop - j);
+		m_bValid = true;
+		return;
+	}
+
+	for (int j = 1; j <= nRows; j++)
+		Generate(m_nTop + j);
+	m_nTop += nRows;
+}
+
+long ScrollingBackground::Position() const {
+	return m_nTop;
+}
+
+void ScrollingBackground::Invalidate() {
+	m_bValid = false;
+}
+
+void ScrollingBackground::DrawTo(ConsoleGameEngine* engine, int x, int y) const {
+	if (!m_bValid)
+		return;
+
+	// Screen rows run from the top row's slot to the end of the ring, then
+	// on from its start
+	int nTopSlot = Slot(m_nTop);
+	int nFirst = m_nHeight - nTopSlot;
+	engine->DrawCells(x, y, m_nWidth, nFirst, m_cells.data() + nTopSlot * m_nWidth, m_nWidth);
+	engine->DrawCells(x, y + nFirst, m_nWidth, nTopSlot, m_cells.data(), m_nWidth);
+}
+
+int ScrollingBackground::Slot(long nRow) const {
+	long nSlot = -nRow % m_nHeight;
+	return (int) (nSlot < 0 ? nSlot + m_nHeight : nSlot);
+}
+
+void ScrollingBackground::Generate(long nRow) {
+	m_generator(nRow, m_cells.data() + Slot(nRow) * m_nWidth, m_nWidth);
+}
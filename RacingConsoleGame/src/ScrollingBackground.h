@@ -0,0 +1,43 @@
+#pragma once
+#include "ConsoleGameEngine.h"
+#include <vector>
+#include <functional>
+
+// Fills pCells, nWidth cells, with row nRow of an endless background. Rows
+// are numbered upwards, the one scrolling in at the top is always the
+// highest so far
+typedef std::function<void(long nRow, CHAR_INFO* pCells, int nWidth)> ROW_GENERATOR;
+
+// A background scrolling down the screen, kept as a ring of rows. Scroll()
+// only moves the start of the ring and generates the rows coming in at the
+// top, DrawTo() copies the ring in its two wrapped halves. The cost of a
+// frame is the rows scrolled in, not the size of the background.
+class ScrollingBackground {
+public:
+	ScrollingBackground(int nWidth, int nHeight, ROW_GENERATOR generator);
+
+	// Move nRows further along, every row is generated on the first call
+	void Scroll(int nRows);
+
+	// Row shown at the top
+	long Position() const;
+
+	// Generate every row again, e.g. after the generator changed
+	void Invalidate();
+
+	void DrawTo(ConsoleGameEngine* engine, int x, int y) const;
+
+private:
+	// Ring slot holding nRow, rows further along go to lower slots so the
+	// rows on screen run forwards through the ring
+	int Slot(long nRow) const;
+
+	void Generate(long nRow);
+
+	int m_nWidth;
+	int m_nHeight;
+	ROW_GENERATOR m_generator;
+	long m_nTop = 0;
+	bool m_bValid = false;
+	std::vector<CHAR_INFO> m_cells;
+};
@@ -0,0 +1,196 @@
+#include "Simulation.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace {
+	// Small private generator for the bots, the engine's Random() belongs to the game
+	unsigned int NextRandom(unsigned int& state) {
+		state = state * 1664525u + 1013904223u;
+		return state >> 8;
+	}
+
+	sSimulationStat MakeStat(std::vector<double> values) {
+		sSimulationStat stat;
+		if (values.empty())
+			return stat;
+
+		std::sort(values.begin(), values.end());
+
+		double sum = 0.0;
+		for (double v : values)
+			sum += v;
+		stat.fMean = sum / values.size();
+
+		double var = 0.0;
+		for (double v : values)
+			var += (v - stat.fMean) * (v - stat.fMean);
+		stat.fStdDev = std::sqrt(var / values.size());
+
+		stat.fMin = values.front();
+		stat.fMax = values.back();
+		stat.fMedian = values[values.size() / 2];
+		return stat;
+	}
+}
+
+Simulation::Simulation(const GameConfig& config, BOT_TYPE bot) {
+	this->config = config;
+	this->bot = bot;
+	fTimeStep = 1.0f / 60.0f;
+	fMaxTime = 120.0f;
+	nSeed = 1;
+	pAssets = std::make_shared<AssetCache>();
+}
+
+void Simulation::SetTimeStep(float fTimeStep) {
+	this->fTimeStep = fTimeStep;
+}
+
+void Simulation::SetMaxTime(float fMaxTime) {
+	this->fMaxTime = fMaxTime;
+}
+
+void Simulation::SetSeed(unsigned int nSeed) {
+	this->nSeed = nSeed;
+}
+
+AssetCache& Simulation::Assets() {
+	return *pAssets;
+}
+
+std::vector<sSimulationResult> Simulation::Run(ThreadPool& pool, int nRuns) const {
+	// Every run writes its own slot, no locking needed
+	std::vector<sSimulationResult> results(nRuns);
+
+	for (int i = 0; i < nRuns; i++) {
+		pool.Submit([this, &results, i] {
+			results[i] = RunSession(nSeed + i);
+		});
+	}
+
+	pool.Wait();
+	return results;
+}
+
+sSimulationResult Simulation::RunSession(unsigned int nSeed) const {
+	sSimulationResult result;
+	result.nSeed = nSeed;
+
+	Game game(config);
+	game.SetRandomSeed(nSeed);
+	game.SetAssetCache(pAssets);
+	game.ConstructHeadless(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+	if (game.StartHeadless()) {
+		sInputFrame input;
+		input.fElapsedTime = fTimeStep;
+		unsigned int nRandom = nSeed ^ 0x9E3779B9u;
+
+		while (game.TimeSinceStart() < fMaxTime) {
+			BotInput(game, input, nRandom);
+			result.nFrames++;
+
+			if (!game.StepHeadless(input))
+				break;
+
+			if (game.IsGameOver()) {
+				result.bCrashed = true;
+				break;
+			}
+		}
+
+		result.nScore = game.Score();
+		result.fSurvivalTime = game.TimeSinceStart();
+	}
+
+	game.StopHeadless();
+	return result;
+}
+
+void Simulation::BotInput(const Game& game, sInputFrame& input, unsigned int& nRandom) const {
+	switch (bot) {
+		case BOT_IDLE:
+			break;
+
+		case BOT_RANDOM:
+		{
+			// Change the steering a few times a second and nudge the speed now and then
+			if (NextRandom(nRandom) % 16 == 0) {
+				unsigned int steer = NextRandom(nRandom) % 3;
+				input.SetKey(VK_LEFT, steer == 1);
+				input.SetKey(VK_RIGHT, steer == 2);
+			}
+			input.SetKey(VK_UP, NextRandom(nRandom) % 64 == 0);
+			input.SetKey(VK_DOWN, NextRandom(nRandom) % 64 == 0);
+		}
+		break;
+
+		case BOT_DODGE:
+		{
+			const Car& player = game.Player();
+
+			// Closest NPC that is ahead of the player and overlaps its lane
+			const Car* pThreat = nullptr;
+			for (int i = 0; i < game.NpcCount(); i++) {
+				const Car& npc = game.Npc(i);
+				if (npc.Bottom() < player.Top() - 3 * player.Height() || npc.Top() > player.Bottom())
+					continue;
+				if (npc.Right() + 2 < player.Left() || npc.Left() - 2 > player.Right())
+					continue;
+				if (pThreat == nullptr || npc.Bottom() > pThreat->Bottom())
+					pThreat = &npc;
+			}
+
+			bool bLeft = false;
+			bool bRight = false;
+			if (pThreat != nullptr) {
+				// Pass on the side with more room, unless that side is blocked by the border
+				int nRoomLeft = pThreat->Left() - game.Border().Left();
+				int nRoomRight = game.Border().Right() - pThreat->Right();
+				if (nRoomLeft > nRoomRight)
+					bLeft = true;
+				else
+					bRight = true;
+			}
+			input.SetKey(VK_LEFT, bLeft);
+			input.SetKey(VK_RIGHT, bRight);
+		}
+		break;
+	}
+}
+
+sSimulationStat Simulation::ScoreStat(const std::vector<sSimulationResult>& results) {
+	std::vector<double> values;
+	for (auto& r : results)
+		values.push_back(r.nScore);
+	return MakeStat(values);
+}
+
+sSimulationStat Simulation::SurvivalStat(const std::vector<sSimulationResult>& results) {
+	std::vector<double> values;
+	for (auto& r : results)
+		values.push_back(r.fSurvivalTime);
+	return MakeStat(values);
+}
+
+void Simulation::Report(const std::vector<sSimulationResult>& results, double fWallTime) {
+	long nFrames = 0;
+	int nCrashed = 0;
+	for (auto& r : results) {
+		nFrames += r.nFrames;
+		if (r.bCrashed)
+			nCrashed++;
+	}
+
+	sSimulationStat score = ScoreStat(results);
+	sSimulationStat survival = SurvivalStat(results);
+
+	wprintf(L"%d runs, %d crashed, %ld frames in %.2fs (%.0f frames/s)\n",
+			(int) results.size(), nCrashed, nFrames, fWallTime, fWallTime > 0.0 ? nFrames / fWallTime : 0.0);
+	wprintf(L"%-10s %10s %10s %10s %10s %10s\n", L"", L"mean", L"stddev", L"min", L"median", L"max");
+	wprintf(L"%-10s %10.1f %10.1f %10.0f %10.0f %10.0f\n", L"score",
+			score.fMean, score.fStdDev, score.fMin, score.fMedian, score.fMax);
+	wprintf(L"%-10s %10.2f %10.2f %10.2f %10.2f %10.2f\n", L"survival",
+			survival.fMean, survival.fStdDev, survival.fMin, survival.fMedian, survival.fMax);
+}
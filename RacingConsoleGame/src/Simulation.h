@@ -0,0 +1,62 @@
+#pragma once
+#include "Game.h"
+#include "ThreadPool.h"
+#include <vector>
+
+enum BOT_TYPE {
+	BOT_IDLE,		// never touches the keys
+	BOT_RANDOM,		// random steering and speed changes
+	BOT_DODGE,		// steers away from the closest NPC ahead
+};
+
+struct sSimulationResult {
+	unsigned int nSeed = 0;
+	int nScore = 0;
+	float fSurvivalTime = 0.0f;
+	long nFrames = 0;
+	bool bCrashed = false;
+};
+
+struct sSimulationStat {
+	double fMean = 0.0;
+	double fStdDev = 0.0;
+	double fMin = 0.0;
+	double fMedian = 0.0;
+	double fMax = 0.0;
+};
+
+// Runs many headless Game sessions of one GameConfig across a ThreadPool.
+// Each session ends when the player crashes or fMaxTime of game time has
+// passed. Sessions are seeded from nSeed + run index, so a batch is
+// reproducible regardless of how the runs were spread over the threads.
+// All sessions load their sprites through one shared AssetCache.
+class Simulation {
+public:
+	Simulation(const GameConfig& config, BOT_TYPE bot = BOT_DODGE);
+
+	void SetTimeStep(float fTimeStep);
+	void SetMaxTime(float fMaxTime);
+	void SetSeed(unsigned int nSeed);
+
+	AssetCache& Assets();
+
+	std::vector<sSimulationResult> Run(ThreadPool& pool, int nRuns) const;
+
+	// Plays a single session on the calling thread
+	sSimulationResult RunSession(unsigned int nSeed) const;
+
+	static sSimulationStat ScoreStat(const std::vector<sSimulationResult>& results);
+	static sSimulationStat SurvivalStat(const std::vector<sSimulationResult>& results);
+
+	static void Report(const std::vector<sSimulationResult>& results, double fWallTime);
+
+private:
+	void BotInput(const Game& game, sInputFrame& input, unsigned int& nRandom) const;
+
+	GameConfig config;
+	BOT_TYPE bot;
+	float fTimeStep;
+	float fMaxTime;
+	unsigned int nSeed;
+	std::shared_ptr<AssetCache> pAssets;
+};
@@ -0,0 +1,92 @@
+#include "SpriteAtlas.h"
+
+SpriteAtlas::SpriteAtlas(int nWidth, int nMaxHeight) {
+	m_nWidth = nWidth;
+	m_nHeight = 0;
+	m_nMaxHeight = nMaxHeight;
+	m_bFull = false;
+}
+
+const sAtlasRegion* SpriteAtlas::Get(const Sprite* sprite) {
+	auto it = m_mapRegions.find(sprite->Version());
+	if (it != m_mapRegions.end())
+		return &it->second;
+
+	int w = sprite->nWidth;
+	int h = sprite->nHeight;
+	if (w > m_nWidth)
+		return nullptr;
+
+	// Tightest shelf that takes the sprite
+	sShelf* pShelf = nullptr;
+	for (auto& shelf : m_shelves) {
+		if (shelf.nHeight >= h && shelf.nUsed + w <= m_nWidth && (pShelf == nullptr || shelf.nHeight < pShelf->nHeight))
+			pShelf = &shelf;
+	}
+
+	if (pShelf == nullptr) {
+		if (m_nHeight + h > m_nMaxHeight) {
+			m_bFull = true;
+			return nullptr;
+		}
+
+		m_shelves.push_back({m_nHeight, h, 0});
+		pShelf = &m_shelves.back();
+
+		// Rows are whole, growing the buffer keeps every region where it is
+		m_nHeight += h;
+		CHAR_INFO blank;
+		blank.Char.UnicodeChar = L' ';
+		blank.Attributes = 0;
+		m_cells.resize(m_nWidth * m_nHeight, blank);
+		m_mask.resize(m_nWidth * m_nHeight, 0);
+	}
+
+	sAtlasRegion region = {pShelf->nUsed, pShelf->y, w, h};
+	pShelf->nUsed += w;
+
+	for (int y = 0; y < h; y++) {
+		for (int x = 0; x < w; x++) {
+			int cell = (region.y + y) * m_nWidth + region.x + x;
+			m_cells[cell].Char.UnicodeChar = sprite->GetGlyph(x, y);
+			m_cells[cell].Attributes = sprite->GetColour(x, y);
+			m_mask[cell] = sprite->GetGlyph(x, y) != L' ' ? 0xFFFFFFFF : 0;
+		}
+	}
+
+	return &(m_mapRegions[sprite->Version()] = region);
+}
+
+const sAtlasRegion* SpriteAtlas::Find(const Sprite* sprite) const {
+	auto it = m_mapRegions.find(sprite->Version());
+	return it != m_mapRegions.end() ? &it->second : nullptr;
+}
+
+bool SpriteAtlas::IsFull() const {
+	return m_bFull;
+}
+
+void SpriteAtlas::Clear() {
+	m_nHeight = 0;
+	m_bFull = false;
+	m_cells.clear();
+	m_mask.clear();
+	m_shelves.clear();
+	m_mapRegions.clear();
+}
+
+int SpriteAtlas::Width() const {
+	return m_nWidth;
+}
+
+int SpriteAtlas::Height() const {
+	return m_nHeight;
+}
+
+const CHAR_INFO* SpriteAtlas::Cells() const {
+	return m_cells.data();
+}
+
+const uint32_t* SpriteAtlas::Mask() const {
+	return m_mask.data();
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "ConsoleGameEngine.h"
+#include <vector>
+#include <unordered_map>
+
+// Where a sprite's copy sits in the atlas
+struct sAtlasRegion {
+	int x;
+	int y;
+	int nWidth;
+	int nHeight;
+};
+
+// Copies of many sprites shelf packed into one buffer of cells, next to a
+// mask of their drawable cells for DrawCellsMasked(). A shelf is a band of
+// rows as tall as the first sprite put on it. Each sprite goes on the
+// lowest shelf with room that is at least as tall, a new shelf is opened
+// below the others when there is none. The atlas stops growing at
+// nMaxHeight rows and is then full until Clear().
+class SpriteAtlas {
+public:
+	SpriteAtlas(int nWidth = 256, int nMaxHeight = 1024);
+
+	// The region of sprite, copied in on the first call. nullptr if the
+	// sprite is wider than the atlas or there is no room left for it.
+	// Sprites are told apart by Sprite::Version(), so a changed sprite is
+	// copied in again. Regions handed out stay put until Clear()
+	const sAtlasRegion* Get(const Sprite* sprite);
+
+	// Get() for a sprite already copied in, nullptr otherwise. Only reads
+	const sAtlasRegion* Find(const Sprite* sprite) const;
+
+	// A sprite did not fit since the last Clear()
+	bool IsFull() const;
+
+	void Clear();
+
+	int Width() const;
+	int Height() const;
+	const CHAR_INFO* Cells() const;
+	const uint32_t* Mask() const;
+
+private:
+	struct sShelf {
+		int y;
+		int nHeight;
+		int nUsed;
+	};
+
+	int m_nWidth;
+	int m_nHeight;
+	int m_nMaxHeight;
+	bool m_bFull;
+	std::vector<CHAR_INFO> m_cells;
+	std::vector<uint32_t> m_mask;
+	std::vector<sShelf> m_shelves;
+	std::unordered_map<uint64_t, sAtlasRegion> m_mapRegions;
+};
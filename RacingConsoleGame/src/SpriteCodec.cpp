@@ -0,0 +1,160 @@
+#include "SpriteCodec.h"
+#include <cstring>
+
+namespace {
+	const uint16_t BLANK_GLYPH = 0x0020;
+
+	const uint8_t OP_SKIP = 0x00;
+	const uint8_t OP_REPEAT = 0x80;
+	const uint8_t OP_LITERAL = 0xC0;
+	const int MAX_SKIP = 0x80;
+	const int MAX_RUN = 0x40;
+
+	// Runs this long or longer are cheaper as OP_REPEAT than inside a literal
+	const int MIN_REPEAT = 3;
+}
+
+size_t sSpriteSpans::Bytes() const {
+	return palette.size() * sizeof(sSpriteCell) + spans.size() * sizeof(sSpriteSpan) +
+		rowSpans.size() * sizeof(int32_t) + indices.size();
+}
+
+bool EncodeSpriteCells(const sSpriteCell* pCells, int nWidth, int nHeight, std::vector<char>& data) {
+	// Palette of the drawable cells, in order of first use
+	std::vector<sSpriteCell> palette;
+	std::vector<uint8_t> index(nWidth * nHeight, 0);
+	for (int i = 0; i < nWidth * nHeight; i++) {
+		if (pCells[i].glyph == BLANK_GLYPH)
+			continue;
+
+		size_t p = 0;
+		while (p < palette.size() && (palette[p].glyph != pCells[i].glyph || palette[p].colour != pCells[i].colour))
+			p++;
+		if (p == palette.size()) {
+			if (palette.size() == 256)
+				return false;
+			palette.push_back(pCells[i]);
+		}
+		index[i] = (uint8_t) p;
+	}
+
+	data.clear();
+	uint16_t nPalette = (uint16_t) palette.size();
+	uint16_t nReserved = 0;
+	data.insert(data.end(), (const char*) &nPalette, (const char*) &nPalette + sizeof(uint16_t));
+	data.insert(data.end(), (const char*) &nReserved, (const char*) &nReserved + sizeof(uint16_t));
+	data.insert(data.end(), (const char*) palette.data(), (const char*) (palette.data() + palette.size()));
+
+	for (int y = 0; y < nHeight; y++) {
+		const sSpriteCell* pRow = pCells + y * nWidth;
+		const uint8_t* pIndex = index.data() + y * nWidth;
+
+		int x = 0;
+		while (x < nWidth) {
+			if (pRow[x].glyph == BLANK_GLYPH) {
+				int n = 0;
+				while (x + n < nWidth && n < MAX_SKIP && pRow[x + n].glyph == BLANK_GLYPH)
+					n++;
+				data.push_back((char) (OP_SKIP | (n - 1)));
+				x += n;
+				continue;
+			}
+
+			// Length of the run of identical cells starting at x
+			auto Run = [&] (int s) {
+				int n = 1;
+				while (s + n < nWidth && n < MAX_RUN && pRow[s + n].glyph != BLANK_GLYPH && pIndex[s + n] == pIndex[s])
+					n++;
+				return n;
+			};
+
+			int n = Run(x);
+			if (n >= MIN_REPEAT) {
+				data.push_back((char) (OP_REPEAT | (n - 1)));
+				data.push_back((char) pIndex[x]);
+				x += n;
+				continue;
+			}
+
+			// Literal up to the next blank cell or the next run worth repeating
+			n = 0;
+			while (x + n < nWidth && n < MAX_RUN && pRow[x + n].glyph != BLANK_GLYPH && (n == 0 || Run(x + n) < MIN_REPEAT))
+				n++;
+			data.push_back((char) (OP_LITERAL | (n - 1)));
+			data.insert(data.end(), (const char*) pIndex + x, (const char*) pIndex + x + n);
+			x += n;
+		}
+	}
+
+	return true;
+}
+
+bool DecodeSpriteCells(const char* pData, size_t nSize, int nWidth, int nHeight, sSpriteSpans& spans) {
+	spans = sSpriteSpans();
+	if (nSize < 2 * sizeof(uint16_t))
+		return false;
+
+	uint16_t nPalette = 0;
+	memcpy(&nPalette, pData, sizeof(uint16_t));
+	size_t p = 2 * sizeof(uint16_t);
+	if (nPalette > 256 || p + nPalette * sizeof(sSpriteCell) > nSize)
+		return false;
+
+	spans.palette.resize(nPalette);
+	memcpy(spans.palette.data(), pData + p, nPalette * sizeof(sSpriteCell));
+	p += nPalette * sizeof(sSpriteCell);
+
+	const uint8_t* pOps = (const uint8_t*) pData;
+	spans.rowSpans.reserve(nHeight + 1);
+	for (int y = 0; y < nHeight; y++) {
+		spans.rowSpans.push_back((int32_t) spans.spans.size());
+
+		int x = 0;
+		bool bOpen = false;		// the last span can still grow
+		while (x < nWidth) {
+			if (p >= nSize)
+				return false;
+
+			uint8_t op = pOps[p++];
+			int n = (op & 0x80) ? (op & 0x3F) + 1 : op + 1;
+			if (x + n > nWidth)
+				return false;
+
+			if ((op & 0x80) == 0) {
+				bOpen = false;
+				x += n;
+				continue;
+			}
+
+			if (!bOpen) {
+				sSpriteSpan span;
+				span.x = (int16_t) x;
+				span.nLength = 0;
+				span.nIndex = (int32_t) spans.indices.size();
+				spans.spans.push_back(span);
+				bOpen = true;
+			}
+
+			if ((op & 0xC0) == OP_REPEAT) {
+				if (p >= nSize || pOps[p] >= nPalette)
+					return false;
+				spans.indices.insert(spans.indices.end(), n, pOps[p++]);
+			} else {
+				if (p + n > nSize)
+					return false;
+				for (int i = 0; i < n; i++) {
+					if (pOps[p + i] >= nPalette)
+						return false;
+				}
+				spans.indices.insert(spans.indices.end(), pOps + p, pOps + p + n);
+				p += n;
+			}
+
+			spans.spans.back().nLength += (int16_t) n;
+			x += n;
+		}
+	}
+	spans.rowSpans.push_back((int32_t) spans.spans.size());
+
+	return p == nSize;
+}
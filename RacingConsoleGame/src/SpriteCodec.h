@@ -0,0 +1,38 @@
+#pragma once
+#include "SpriteFormat.h"
+#include <vector>
+
+// Compact encoding of sprite cells, used by v2 files with SPRITE_COMPACT set.
+//
+//   uint16 nPalette, uint16 reserved
+//   sSpriteCell palette[nPalette]
+//   every row, left to right, as a list of ops covering exactly nWidth cells
+//     0x00-0x7F  skip op + 1 blank cells
+//     0x80-0xBF  (op & 0x3F) + 1 cells of the one palette index that follows
+//     0xC0-0xFF  (op & 0x3F) + 1 palette indices follow, one per cell
+//
+// Blank cells are the ones whose glyph is a space, the ones the blitter never
+// draws. Their colour is not kept, they decode as a space on FG_BLACK.
+
+// One run of drawable cells in a row, its palette indices are
+// indices[nIndex] .. indices[nIndex + nLength - 1]
+struct sSpriteSpan {
+	int16_t x;
+	int16_t nLength;
+	int32_t nIndex;
+};
+
+// Decoded form of a compact sprite, only the drawable cells are kept
+struct sSpriteSpans {
+	std::vector<sSpriteCell> palette;
+	std::vector<sSpriteSpan> spans;		// row by row, left to right
+	std::vector<int32_t> rowSpans;		// first span of each row, nHeight + 1 entries
+	std::vector<uint8_t> indices;
+
+	size_t Bytes() const;
+};
+
+// False when the sprite has more than 256 distinct drawable cells
+bool EncodeSpriteCells(const sSpriteCell* pCells, int nWidth, int nHeight, std::vector<char>& data);
+
+bool DecodeSpriteCells(const char* pData, size_t nSize, int nWidth, int nHeight, sSpriteSpans& spans);
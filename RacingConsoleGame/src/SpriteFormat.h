@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+// Sprite files, shared by the game and the AssetPacker tool.
+//
+// v1 (what the SpriteEditor writes)
+//   int32 width, int32 height, width * height colours, width * height glyphs
+//
+// v2
+//   sSpriteHeader
+//   nDataSize bytes of cells starting at nCellOffset, either
+//     width * height sSpriteCell, row major
+//     or with SPRITE_COMPACT the palette and run-length coding of SpriteCodec.h
+//
+// A v2 cell is laid out like the console's CHAR_INFO, so the cells of a file
+// mapped into memory can be used as they are. nCellOffset is a multiple of
+// SPRITE_ALIGN. A v1 file can never be mistaken for v2, its first four bytes
+// would have to be a width of over a billion.
+
+const char SPRITE_MAGIC[4] = {'R', 'S', 'P', 'R'};
+const uint16_t SPRITE_VERSION = 2;
+const uint32_t SPRITE_ALIGN = 16;
+
+// nFlags
+const uint16_t SPRITE_CHECKSUM = 0x0001;	// nChecksum holds SpriteChecksum() of the cell data
+const uint16_t SPRITE_COMPACT = 0x0002;		// cells are stored with the SpriteCodec encoding
+
+struct sSpriteHeader {
+	char magic[4];
+	uint16_t nVersion;
+	uint16_t nFlags;
+	int32_t nWidth;
+	int32_t nHeight;
+	uint32_t nCellOffset;
+	uint32_t nChecksum;
+	uint32_t nDataSize;
+	uint32_t nReserved;
+};
+
+struct sSpriteCell {
+	uint16_t glyph;
+	uint16_t colour;
+};
+
+static_assert(sizeof(sSpriteHeader) == 32 && sizeof(sSpriteHeader) % SPRITE_ALIGN == 0, "sprite header layout changed");
+static_assert(sizeof(sSpriteCell) == 4, "sprite cell layout changed");
+
+// Bytes of cell data after the header. Files written before nDataSize was
+// added leave it 0 and always hold plain cells
+inline size_t SpriteDataSize(const sSpriteHeader& header) {
+	if (header.nDataSize == 0 && (header.nFlags & SPRITE_COMPACT) == 0)
+		return (size_t) header.nWidth * header.nHeight * sizeof(sSpriteCell);
+	return header.nDataSize;
+}
+
+// FNV-1a over the cell data as stored
+inline uint32_t SpriteChecksum(const void* pData, size_t nSize) {
+	const unsigned char* p = (const unsigned char*) pData;
+	uint32_t nHash = 2166136261u;
+	for (size_t i = 0; i < nSize; i++) {
+		nHash ^= p[i];
+		nHash *= 16777619u;
+	}
+	return nHash;
+}
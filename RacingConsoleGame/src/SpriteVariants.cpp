@@ -0,0 +1,202 @@
+#include "SpriteVariants.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+	const float TWO_PI = 6.28318530718f;
+
+	float StepAngle(int nStep) {
+		return nStep * (TWO_PI / SPRITE_ANGLE_STEPS);
+	}
+
+	// Narrow t1 .. t2 to the t for which 0 <= p + t * dp < fSize
+	void NarrowTo(float p, float dp, float fSize, float& t1, float& t2) {
+		if (dp == 0.0f) {
+			if (p < 0.0f || p >= fSize)
+				t2 = t1;
+			return;
+		}
+
+		float a = -p / dp;
+		float b = (fSize - p) / dp;
+		t1 = std::max(t1, std::min(a, b));
+		t2 = std::min(t2, std::max(a, b));
+	}
+
+	// Drop the rows and columns of variant nothing was drawn into, the box
+	// around a turned sprite is mostly empty along its edges
+	void Crop(sSpriteVariant& variant) {
+		int x1 = variant.nWidth;
+		int y1 = variant.nHeight;
+		int x2 = 0;
+		int y2 = 0;
+		for (int y = 0; y < variant.nHeight; y++) {
+			for (int x = 0; x < variant.nWidth; x++) {
+				if (variant.mask[y * variant.nWidth + x] == 0)
+					continue;
+
+				x1 = std::min(x1, x);
+				y1 = std::min(y1, y);
+				x2 = std::max(x2, x + 1);
+				y2 = std::max(y2, y + 1);
+			}
+		}
+		if (x1 >= x2)
+			x1 = x2 = y1 = y2 = 0;
+
+		int nWidth = x2 - x1;
+		std::vector<CHAR_INFO> cells(nWidth * (y2 - y1));
+		std::vector<uint32_t> mask(nWidth * (y2 - y1));
+		for (int y = y1; y < y2; y++) {
+			std::copy_n(variant.cells.begin() + y * variant.nWidth + x1, nWidth, cells.begin() + (y - y1) * nWidth);
+			std::copy_n(variant.mask.begin() + y * variant.nWidth + x1, nWidth, mask.begin() + (y - y1) * nWidth);
+		}
+
+		variant.nOffsetX += x1;
+		variant.nOffsetY += y1;
+		variant.nWidth = nWidth;
+		variant.nHeight = y2 - y1;
+		variant.cells.swap(cells);
+		variant.mask.swap(mask);
+	}
+}
+
+sScreenRect TransformedSpriteBounds(int x, int y, const Sprite* sprite, float fAngle, float fScale) {
+	float w = (float) sprite->nWidth;
+	float h = (float) sprite->nHeight;
+	float c = fabsf(cosf(fAngle));
+	float s = fabsf(sinf(fAngle));
+
+	// Half the size of the box around the turned sprite
+	float ex = (c * w + s * h) * 0.5f * fScale;
+	float ey = (s * w + c * h) * 0.5f * fScale;
+	return {x + (int) floorf(w * 0.5f - ex), y + (int) floorf(h * 0.5f - ey),
+			x + (int) ceilf(w * 0.5f + ex), y + (int) ceilf(h * 0.5f + ey)};
+}
+
+void DrawTransformedSprite(const Sprite* sprite, int x, int y, float fAngle, float fScale, bool bMirror,
+						   const sScreenRect& area, CHAR_INFO* pTarget, int nOriginX, int nOriginY, int nStride, uint32_t* pMask) {
+	if (sprite == nullptr || sprite->nWidth <= 0 || sprite->nHeight <= 0 || fScale <= 0.0f)
+		return;
+
+	float w = (float) sprite->nWidth;
+	float h = (float) sprite->nHeight;
+	float c = cosf(fAngle);
+	float s = sinf(fAngle);
+
+	// How far u, v on the sprite move for one cell right and one cell down
+	// on the screen, which turns the other way
+	float dux = (bMirror ? -c : c) / fScale;
+	float dvx = -s / fScale;
+	float duy = (bMirror ? -s : s) / fScale;
+	float dvy = c / fScale;
+
+	// Rows are walked from the left of the bounds whatever area is, and
+	// offsets are taken from x, y, so the same cells come out wherever the
+	// sprite is drawn
+	sScreenRect bounds = TransformedSpriteBounds(0, 0, sprite, fAngle, fScale);
+	float fx = bounds.x1 + 0.5f - w * 0.5f;
+	int x1 = std::max(bounds.x1, area.x1 - x);
+	int x2 = std::min(bounds.x2, area.x2 - x);
+	int y1 = std::max(bounds.y1, area.y1 - y);
+	int y2 = std::min(bounds.y2, area.y2 - y);
+
+	// Every point is worked out from its own column rather than stepped to
+	// from the first one drawn, clipping would move that. Sampling reads the
+	// row above v, hence the extra row
+	float px[256];
+	float py[256];
+	CHAR_INFO cells[256];
+	for (int j = y1; j < y2; j++) {
+		float fy = j + 0.5f - h * 0.5f;
+		float u = fx * dux + fy * duy + w * 0.5f;
+		float v = fx * dvx + fy * dvy + h * 0.5f;
+
+		// Only the stretch of the row that lands on the sprite is sampled
+		float t1 = 0.0f;
+		float t2 = (float) (bounds.x2 - bounds.x1);
+		NarrowTo(u, dux, w, t1, t2);
+		NarrowTo(v, dvx, h, t1, t2);
+		int i1 = std::max((int) ceilf(t1), x1 - bounds.x1);
+		int i2 = std::min((int) ceilf(t2), x2 - bounds.x1);
+
+		CHAR_INFO* pRow = pTarget + (y + j - nOriginY) * nStride + x + bounds.x1 - nOriginX;
+		uint32_t* pRowMask = pMask != nullptr ? pMask + (y + j - nOriginY) * nStride + x + bounds.x1 - nOriginX : nullptr;
+		for (int i = i1; i < i2; i += 256) {
+			int n = std::min(256, i2 - i);
+			for (int k = 0; k < n; k++) {
+				px[k] = (u + (i + k) * dux) / w;
+				py[k] = (v + (i + k) * dvx + 1.0f) / h;
+			}
+			sprite->SampleSpan(px, py, n, cells, SAMPLE_CLAMP);
+			for (int k = 0; k < n; k++) {
+				if (cells[k].Char.UnicodeChar == L' ')
+					continue;
+
+				pRow[i + k] = cells[k];
+				if (pRowMask != nullptr)
+					pRowMask[i + k] = 0xFFFFFFFF;
+			}
+		}
+	}
+}
+
+const sSpriteVariant* SpriteVariants::Get(const Sprite* sprite, int nStep, bool bMirror) {
+	if (sprite == nullptr || nStep < 0 || nStep >= SPRITE_ANGLE_STEPS)
+		return nullptr;
+
+	// Only a new sprite can make room, what was handed out for this one
+	// stays valid
+	if (m_mapVariants.size() >= MAX_SPRITES && m_mapVariants.count(sprite->Version()) == 0)
+		m_mapVariants.clear();
+
+	std::vector<std::unique_ptr<sSpriteVariant>>& variants = m_mapVariants[sprite->Version()];
+	if (variants.empty())
+		variants.resize(2 * SPRITE_ANGLE_STEPS);
+
+	std::unique_ptr<sSpriteVariant>& pVariant = variants[nStep + (bMirror ? SPRITE_ANGLE_STEPS : 0)];
+	if (pVariant != nullptr)
+		return pVariant.get();
+
+	float fAngle = StepAngle(nStep);
+	sScreenRect bounds = TransformedSpriteBounds(0, 0, sprite, fAngle, 1.0f);
+
+	pVariant.reset(new sSpriteVariant());
+	pVariant->nOffsetX = bounds.x1;
+	pVariant->nOffsetY = bounds.y1;
+	pVariant->nWidth = bounds.x2 - bounds.x1;
+	pVariant->nHeight = bounds.y2 - bounds.y1;
+
+	CHAR_INFO blank;
+	blank.Char.UnicodeChar = L' ';
+	blank.Attributes = 0;
+	pVariant->cells.assign(pVariant->nWidth * pVariant->nHeight, blank);
+	pVariant->mask.assign(pVariant->nWidth * pVariant->nHeight, 0);
+
+	DrawTransformedSprite(sprite, 0, 0, fAngle, 1.0f, bMirror, bounds, pVariant->cells.data(),
+						  bounds.x1, bounds.y1, pVariant->nWidth, pVariant->mask.data());
+	Crop(*pVariant);
+	return pVariant.get();
+}
+
+void SpriteVariants::Prepare(const Sprite* sprite) {
+	for (int i = 0; i < SPRITE_ANGLE_STEPS; i++) {
+		Get(sprite, i, false);
+		Get(sprite, i, true);
+	}
+}
+
+void SpriteVariants::Clear() {
+	m_mapVariants.clear();
+}
+
+size_t SpriteVariants::Bytes() const {
+	size_t nBytes = 0;
+	for (auto& entry : m_mapVariants) {
+		for (auto& pVariant : entry.second) {
+			if (pVariant != nullptr)
+				nBytes += pVariant->cells.size() * sizeof(CHAR_INFO) + pVariant->mask.size() * sizeof(uint32_t);
+		}
+	}
+	return nBytes;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include "ConsoleGameEngine.h"
+#include <vector>
+#include <unordered_map>
+
+// A sprite turned and scaled ahead of time. Drawn with DrawCellsMasked() at
+// (x + nOffsetX, y + nOffsetY) it gives what DrawSpriteTransformed() draws
+// for the sprite at x, y
+struct sSpriteVariant {
+	int nOffsetX;
+	int nOffsetY;
+	int nWidth;
+	int nHeight;
+	std::vector<CHAR_INFO> cells;
+	std::vector<uint32_t> mask;
+};
+
+// The cells sprite can cover when DrawSpriteTransformed() draws it at x, y
+sScreenRect TransformedSpriteBounds(int x, int y, const Sprite* sprite, float fAngle, float fScale);
+
+// Inverse mapped drawing behind DrawSpriteTransformed(). Every cell of area
+// is traced back onto the sprite, a row at a time through SampleSpan(), and
+// the drawable ones are written to pTarget, whose first cell is at nOriginX,
+// nOriginY and whose rows are nStride cells apart. pMask, when given, gets
+// 0xFFFFFFFF for every cell written. The rows only cover the cells that
+// land on the sprite, so what comes out does not depend on x, y or area
+void DrawTransformedSprite(const Sprite* sprite, int x, int y, float fAngle, float fScale, bool bMirror,
+						   const sScreenRect& area, CHAR_INFO* pTarget, int nOriginX, int nOriginY, int nStride, uint32_t* pMask);
+
+// Copies of sprites turned to every multiple of 2 pi / SPRITE_ANGLE_STEPS at
+// scale 1, plain and mirrored. A sprite's copies are made one at a time as
+// they are asked for, or all at once by Prepare(). Sprites are told apart by
+// Sprite::Version(), a changed sprite gets new copies. Past MAX_SPRITES
+// sprites everything is dropped and made again as it is asked for
+class SpriteVariants {
+public:
+	// nStep in 0 .. SPRITE_ANGLE_STEPS - 1
+	const sSpriteVariant* Get(const Sprite* sprite, int nStep, bool bMirror);
+
+	void Prepare(const Sprite* sprite);
+
+	void Clear();
+
+	// Cells and masks held for all sprites
+	size_t Bytes() const;
+
+private:
+	static const size_t MAX_SPRITES = 32;
+
+	// 2 * SPRITE_ANGLE_STEPS per sprite, mirrored ones last, empty until made
+	std::unordered_map<uint64_t, std::vector<std::unique_ptr<sSpriteVariant>>> m_mapVariants;
+};
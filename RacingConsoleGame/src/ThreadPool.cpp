@@ -0,0 +1,137 @@
+#include "ThreadPool.h"
+#include <cassert>
+
+namespace {
+	// Which pool and queue the current thread works for, if any
+	thread_local ThreadPool* tlPool = nullptr;
+	thread_local unsigned int tlWorker = 0;
+}
+
+ThreadPool::ThreadPool(unsigned int nThreads) {
+	if (nThreads == 0)
+		nThreads = std::thread::hardware_concurrency();
+	if (nThreads == 0)
+		nThreads = 1;
+
+	m_bActive = true;
+	m_nQueued = 0;
+	m_nPending = 0;
+	m_nNextQueue = 0;
+
+	for (unsigned int i = 0; i < nThreads; i++)
+		m_queues.push_back(std::unique_ptr<sWorkQueue>(new sWorkQueue()));
+
+	for (unsigned int i = 0; i < nThreads; i++)
+		m_threads.push_back(std::thread(&ThreadPool::WorkerThread, this, i));
+}
+
+ThreadPool::~ThreadPool() {
+	Wait();
+
+	{
+		std::unique_lock<std::mutex> lm(m_muxWake);
+		m_bActive = false;
+	}
+	m_cvWake.notify_all();
+
+	for (auto& t : m_threads)
+		t.join();
+}
+
+void ThreadPool::Submit(std::function<void()> task) {
+	unsigned int nQueue;
+	if (tlPool == this)
+		nQueue = tlWorker;
+	else
+		nQueue = m_nNextQueue++ % m_queues.size();
+
+	m_nPending++;
+	{
+		// Counted under the queue lock, so the task cannot be taken and
+		// uncounted before it is counted
+		std::unique_lock<std::mutex> lq(m_queues[nQueue]->mux);
+		m_queues[nQueue]->tasks.push_back(std::move(task));
+		m_nQueued++;
+	}
+
+	// A worker between checking m_nQueued and waiting still gets the wake,
+	// and so does Wait(), which helps with any new task
+	{
+		std::unique_lock<std::mutex> lm(m_muxWake);
+	}
+	m_cvWake.notify_one();
+	m_cvDone.notify_all();
+}
+
+void ThreadPool::Wait() {
+	assert(tlPool != this);
+
+	std::function<void()> task;
+	unsigned int nWorker = 0;
+
+	while (m_nPending > 0) {
+		if (PopTask(nWorker, task)) {
+			RunTask(task);
+			continue;
+		}
+
+		// Nothing left to steal, the remaining tasks are running elsewhere
+		std::unique_lock<std::mutex> lm(m_muxWake);
+		m_cvDone.wait(lm, [this] { return m_nPending == 0 || m_nQueued > 0; });
+	}
+}
+
+unsigned int ThreadPool::Size() const {
+	return (unsigned int) m_threads.size();
+}
+
+void ThreadPool::WorkerThread(unsigned int nWorker) {
+	tlPool = this;
+	tlWorker = nWorker;
+
+	std::function<void()> task;
+	while (true) {
+		if (PopTask(nWorker, task)) {
+			RunTask(task);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lm(m_muxWake);
+		m_cvWake.wait(lm, [this] { return m_nQueued > 0 || !m_bActive; });
+		if (!m_bActive && m_nQueued == 0)
+			return;
+	}
+}
+
+bool ThreadPool::PopTask(unsigned int nWorker, std::function<void()>& task) {
+	unsigned int nQueues = (unsigned int) m_queues.size();
+
+	for (unsigned int i = 0; i < nQueues; i++) {
+		sWorkQueue& q = *m_queues[(nWorker + i) % nQueues];
+		std::unique_lock<std::mutex> lq(q.mux);
+		if (q.tasks.empty())
+			continue;
+
+		if (i == 0) {
+			task = std::move(q.tasks.back());
+			q.tasks.pop_back();
+		} else {
+			task = std::move(q.tasks.front());
+			q.tasks.pop_front();
+		}
+		m_nQueued--;
+		return true;
+	}
+
+	return false;
+}
+
+void ThreadPool::RunTask(std::function<void()>& task) {
+	task();
+	task = nullptr;
+
+	if (--m_nPending == 0) {
+		std::unique_lock<std::mutex> lm(m_muxWake);
+		m_cvDone.notify_all();
+	}
+}
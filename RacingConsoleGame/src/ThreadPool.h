@@ -0,0 +1,77 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <future>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+
+// Fixed size pool of worker threads with one task queue per worker. A worker
+// takes its newest task from the back of its own queue and, when that is
+// empty, steals the oldest task from the front of another worker's queue, so
+// uneven tasks spread themselves over all cores without a central bottleneck.
+class ThreadPool {
+public:
+	// nThreads = 0 sizes the pool to the number of hardware threads
+	ThreadPool(unsigned int nThreads = 0);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	// Queue a task. Tasks submitted from inside a worker go to that worker's
+	// own queue, others are dealt round robin
+	void Submit(std::function<void()> task);
+
+	// Queue f and hand back its result, or the exception it threw, through a future
+	template<typename F>
+	auto Async(F f) -> std::future<decltype(f())> {
+		typedef decltype(f()) R;
+		std::shared_ptr<std::packaged_task<R()>> pTask = std::make_shared<std::packaged_task<R()>>(std::move(f));
+		std::future<R> result = pTask->get_future();
+		Submit([pTask] { (*pTask)(); });
+		return result;
+	}
+
+	// Block until every submitted task has finished. The calling thread runs
+	// tasks itself while it waits. Not from inside a task of this pool, that
+	// task would be waiting for itself to finish
+	void Wait();
+
+	unsigned int Size() const;
+
+private:
+	struct sWorkQueue {
+		std::deque<std::function<void()>> tasks;
+		std::mutex mux;
+	};
+
+	void WorkerThread(unsigned int nWorker);
+
+	// Own queue first (newest task), then steal from the others (oldest task)
+	bool PopTask(unsigned int nWorker, std::function<void()>& task);
+
+	void RunTask(std::function<void()>& task);
+
+	std::vector<std::unique_ptr<sWorkQueue>> m_queues;
+	std::vector<std::thread> m_threads;
+
+	std::atomic<bool> m_bActive;
+	std::atomic<unsigned int> m_nQueued;
+	std::atomic<unsigned int> m_nPending;
+	std::atomic<unsigned int> m_nNextQueue;
+
+	std::mutex m_muxWake;
+	std::condition_variable m_cvWake;
+	std::condition_variable m_cvDone;
+};
+
+// True once future holds its value, never blocks
+template<typename T>
+bool IsReady(const T& future) {
+	return future.valid() && future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
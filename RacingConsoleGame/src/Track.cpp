@@ -0,0 +1,97 @@
+#include "Track.h"
+#include <algorithm>
+
+namespace {
+	const int MIN_WIDTH = 40;
+	const int LANE_WIDTH = 22;
+	const int MIN_CHUNK = 80;
+	const int MAX_CHUNK = 240;
+
+	// Row the track starts on, far enough below row 0 to fill the first screen
+	const long FIRST_ROW = -256;
+
+	// 0 to 1 with zero slope at both ends
+	float Ease(float t) {
+		return t * t * (3.0f - 2.0f * t);
+	}
+}
+
+Track::Track(unsigned int seed, int areaLeft, int areaRight) {
+	this->random = seed;
+	this->areaLeft = areaLeft;
+	this->areaRight = areaRight;
+	this->nextStart = FIRST_ROW;
+}
+
+TrackRow Track::Row(long row) {
+	while (chunks.empty() || row >= nextStart)
+		AddChunk();
+
+	// Chunks are sorted and few, the last ones are the likely match
+	auto it = std::upper_bound(chunks.begin(), chunks.end(), row, [] (long r, const TrackChunk& chunk) { return r < chunk.start; });
+	const TrackChunk& chunk = (it == chunks.begin()) ? chunks.front() : *(it - 1);
+
+	float t = Ease(std::min(std::max((row - chunk.start) / (float) chunk.length, 0.0f), 1.0f));
+	float centre = chunk.centreStart + (chunk.centreEnd - chunk.centreStart) * t;
+	int width = (int) (chunk.widthStart + (chunk.widthEnd - chunk.widthStart) * t + 0.5f);
+
+	TrackRow result;
+	result.left = (int) (centre - width / 2.0f + 0.5f);
+	result.right = result.left + width;
+	result.lanes = chunk.lanes;
+	return result;
+}
+
+void Track::Forget(long row) {
+	// The newest chunk always stays, Row() continues from it
+	while (chunks.size() > 1 && chunks.front().start + chunks.front().length <= row)
+		chunks.pop_front();
+}
+
+int Track::ResidentChunks() const {
+	return (int) chunks.size();
+}
+
+void Track::AddChunk() {
+	int maxWidth = areaRight - areaLeft - 4;
+
+	TrackChunk chunk;
+	chunk.start = nextStart;
+	chunk.length = MIN_CHUNK + Next(MAX_CHUNK - MIN_CHUNK + 1);
+
+	if (chunks.empty()) {
+		chunk.centreStart = (areaLeft + areaRight) / 2;
+		chunk.widthStart = (MIN_WIDTH + maxWidth) / 2;
+	} else {
+		chunk.centreStart = chunks.back().centreEnd;
+		chunk.widthStart = chunks.back().widthEnd;
+	}
+
+	// Straights, bends and changes of width in about equal measure
+	chunk.centreEnd = chunk.centreStart;
+	chunk.widthEnd = chunk.widthStart;
+	switch (Next(3)) {
+	case 0:
+		break;
+	case 1:
+		chunk.centreEnd += Next(61) - 30;
+		break;
+	case 2:
+		chunk.widthEnd = MIN_WIDTH + Next(maxWidth - MIN_WIDTH + 1);
+		break;
+	}
+
+	// Keep both ends of the chunk inside the strip, one column off the edges
+	int halfWidth = std::max(chunk.widthStart, chunk.widthEnd) / 2 + 1;
+	chunk.centreEnd = std::min(std::max(chunk.centreEnd, areaLeft + halfWidth + 1), areaRight - halfWidth - 1);
+
+	chunk.lanes = std::max(1, std::min(chunk.widthStart, chunk.widthEnd) / LANE_WIDTH);
+
+	chunks.push_back(chunk);
+	nextStart += chunk.length;
+}
+
+int Track::Next(int n) {
+	random = random * 1664525u + 1013904223u;
+	return (int) ((random >> 8) % (unsigned int) n);
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <deque>
+
+// Where the road is on one row of the track
+struct TrackRow {
+	int left;		// first column of tarmac
+	int right;		// one past the last
+	int lanes;
+};
+
+// One stretch of road. Centre and width move from their start to their end
+// values along the chunk, eased at both ends so chunks join smoothly
+struct TrackChunk {
+	long start;		// first row
+	int length;
+	int centreStart;
+	int centreEnd;
+	int widthStart;
+	int widthEnd;
+	int lanes;
+};
+
+// An endless road generated from a seed, a chunk at a time, inside a strip
+// of columns [areaLeft, areaRight). Rows are numbered like those of a
+// ScrollingBackground, upwards from row 0 at the top of the first screen.
+// Only the chunks between Forget() and the furthest row asked for are
+// kept, so memory and the cost per row stay the same however long a
+// session runs, and the same seed always lays out the same track. That is
+// up to the rows in use over 80, the shortest chunk, plus two: 4 or 5 for
+// the top-down road, around ten for the perspective view 600 rows ahead.
+class Track {
+public:
+	Track(unsigned int seed, int areaLeft, int areaRight);
+
+	// The road on row, generating chunks up to it when needed. Rows before
+	// the first chunk kept look like its start
+	TrackRow Row(long row);
+
+	// Drop the chunks that end before row
+	void Forget(long row);
+
+	int ResidentChunks() const;
+
+private:
+	void AddChunk();
+	int Next(int n);
+
+	unsigned int random;
+	int areaLeft;
+	int areaRight;
+	long nextStart;
+	std::deque<TrackChunk> chunks;
+};
@@ -1,96 +1,122 @@
 #include "font.h"
 
-Font::Font(std::wstring fontFolder){
-	OpenFolder(fontFolder);
-	LoadFont();
+Font::Font(AssetCache& assets, std::wstring fontFolder){
+	this->assets = &assets;
+	assetGeneration = assets.Generation();
+	drawCount = 0;
+
+	LoadFont(assets, fontFolder);
 }
 
 Font::~Font() {
 }
 
-int Font::GetSpriteIndex(char c){
-	if(c >= 'A' && c <= 'Z')
-		return ((int)c - 55);
-
-	if(c >= '0' && c <= '9')
-		return ((int)c - 48);
-	
-	return -1;
+const Font::sGlyph& Font::GetGlyph(char c) const {
+	return glyphs[FONT_SLOTS.slot[(unsigned char) c]];
 }
 
-void Font::OpenFolder(std::wstring fontFolder){
-	fontPath[0] = fontFolder + L"/0.spr";
-	fontPath[1] = fontFolder + L"/1.spr";
-	fontPath[2] = fontFolder + L"/2.spr";
-	fontPath[3] = fontFolder + L"/3.spr";
-	fontPath[4] = fontFolder + L"/4.spr";
-	fontPath[5] = fontFolder + L"/5.spr";
-	fontPath[6] = fontFolder + L"/6.spr";
-	fontPath[7] = fontFolder + L"/7.spr";
-	fontPath[8] = fontFolder + L"/8.spr";
-	fontPath[9] = fontFolder + L"/9.spr";
-	fontPath[10] = fontFolder + L"/A.spr";
-	fontPath[11] = fontFolder + L"/B.spr";
-	fontPath[12] = fontFolder + L"/C.spr";
-	fontPath[13] = fontFolder + L"/D.spr";
-	fontPath[14] = fontFolder + L"/E.spr";
-	fontPath[15] = fontFolder + L"/F.spr";
-	fontPath[16] = fontFolder + L"/G.spr";
-	fontPath[17] = fontFolder + L"/H.spr";
-	fontPath[18] = fontFolder + L"/I.spr";
-	fontPath[19] = fontFolder + L"/J.spr";
-	fontPath[20] = fontFolder + L"/K.spr";
-	fontPath[21] = fontFolder + L"/L.spr";
-	fontPath[22] = fontFolder + L"/M.spr";
-	fontPath[23] = fontFolder + L"/N.spr";
-	fontPath[24] = fontFolder + L"/O.spr";
-	fontPath[25] = fontFolder + L"/P.spr";
-	fontPath[26] = fontFolder + L"/Q.spr";
-	fontPath[27] = fontFolder + L"/R.spr";
-	fontPath[28] = fontFolder + L"/S.spr";
-	fontPath[29] = fontFolder + L"/T.spr";
-	fontPath[30] = fontFolder + L"/U.spr";
-	fontPath[31] = fontFolder + L"/V.spr";
-	fontPath[32] = fontFolder + L"/W.spr";
-	fontPath[33] = fontFolder + L"/X.spr";
-	fontPath[34] = fontFolder + L"/Y.spr";
-	fontPath[35] = fontFolder + L"/Z.spr";
+bool Font::LoadFont(AssetCache& assets, std::wstring fontFolder){
+	folder = fontFolder;
+	atlas = assets.LoadSprite(fontFolder + L"/atlas.spr");
+	MeasureGlyphs();
+	return atlas->nWidth >= FONT_GLYPHS;
 }
 
-bool Font::LoadFont(){
-	int w = 0, h = 0;
-	for (int i = 0; i < ALPHABET; i++){
-		if(!fontSpr[i].Load(fontPath[i]))
-			return false;
-		if (fontSpr[i].nHeight > h)
-			h = fontSpr[i].nHeight;
-		if (fontSpr[i].nWidth > w)
-			w = fontSpr[i].nWidth;
+void Font::MeasureGlyphs(){
+	width = atlas->nWidth / FONT_GLYPHS;
+	height = atlas->nHeight;
+
+	for (int i = 0; i < FONT_GLYPHS; i++) {
+		// Drawn width, up to the rightmost column that is not blank
+		int w = 0;
+		for (int x = 0; x < width; x++) {
+			for (int y = 0; y < height; y++) {
+				if (atlas->GetGlyph(i * width + x, y) != L' ')
+					w = x + 1;
+			}
+		}
+
+		glyphs[i].x = i * width;
+		glyphs[i].nWidth = w;
+		glyphs[i].nAdvance = w + 1;
 	}
 
-	this->width = w;
-	this->height = h;
+	glyphs[FONT_SPACE].x = 0;
+	glyphs[FONT_SPACE].nWidth = 0;
+	glyphs[FONT_SPACE].nAdvance = width + 1;
+}
+
+void Font::DrawString(ConsoleGameEngine* engine, const std::string& str, int x, int y){
+	const sTextRun& run = GetTextRun(str);
+	engine->DrawCellsMasked(x, y, run.nWidth, height, run.cells.data(), run.mask.data(), run.nWidth);
+
+	last.x = x + run.nWidth;
+	last.y = y;
+}
 
-	return true;
+void Font::DrawString(ConsoleGameEngine* engine, const std::string& str, Point position) {
+	DrawString(engine, str, position.x, position.y);
 }
 
-void Font::DrawString(ConsoleGameEngine* engine, std::string str, int x, int y){
-	for (size_t i = 0; i < str.length(); i++) {
-		if(GetSpriteIndex(str[i]) == -1){
-			x += width + 1;
-			continue;
+const Font::sTextRun& Font::GetTextRun(const std::string& str) {
+	// The atlas may have been reloaded, which leaves the glyph metrics and
+	// every run out of date
+	if (assets->Generation() != assetGeneration) {
+		assetGeneration = assets->Generation();
+		atlas = assets->LoadSprite(folder + L"/atlas.spr");
+		MeasureGlyphs();
+		textRuns.clear();
+	}
+
+	drawCount++;
+	auto it = textRuns.find(str);
+	if (it != textRuns.end()) {
+		it->second.nLastUsed = drawCount;
+		return it->second;
+	}
+
+	if (textRuns.size() >= MAX_TEXT_RUNS) {
+		auto oldest = textRuns.begin();
+		for (auto run = textRuns.begin(); run != textRuns.end(); ++run) {
+			if (run->second.nLastUsed < oldest->second.nLastUsed)
+				oldest = run;
 		}
-		engine->DrawSprite(x, y, &fontSpr[GetSpriteIndex(str[i])]);
-		x += width + 1;
+		textRuns.erase(oldest);
 	}
-	last.x = x;
-	last.y = y;
+
+	sTextRun& run = textRuns[str];
+	BuildTextRun(str, run);
+	run.nLastUsed = drawCount;
+	return run;
 }
 
-void Font::DrawString(ConsoleGameEngine* engine, std::string str, Point position) {
-	int x = position.x;
-	int y = position.y;
-	DrawString(engine, str, x, y);
+void Font::BuildTextRun(const std::string& str, sTextRun& run){
+	int w = 0;
+	for (char c : str)
+		w += GetGlyph(c).nAdvance;
+
+	run.nWidth = w;
+	run.cells.assign(w * height, CHAR_INFO());
+	run.mask.assign(w * height, 0);
+
+	// Every glyph is a rectangle of the one atlas
+	int x = 0;
+	for (char c : str) {
+		const sGlyph& glyph = GetGlyph(c);
+		for (int gy = 0; gy < height; gy++) {
+			for (int gx = 0; gx < glyph.nWidth; gx++) {
+				short g = atlas->GetGlyph(glyph.x + gx, gy);
+				if (g == L' ')
+					continue;
+
+				int cell = gy * w + x + gx;
+				run.cells[cell].Char.UnicodeChar = g;
+				run.cells[cell].Attributes = atlas->GetColour(glyph.x + gx, gy);
+				run.mask[cell] = 0xFFFFFFFF;
+			}
+		}
+		x += glyph.nAdvance;
+	}
 }
 
 void Font::Endl() {
@@ -99,4 +125,8 @@ void Font::Endl() {
 
 Point Font::GetLastPosition() const {
 	return last;
+}
+
+int Font::Height() const {
+	return height;
 }
\ No newline at end of file
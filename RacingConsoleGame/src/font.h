@@ -1,35 +1,92 @@
+#pragma once
 #include "ConsoleGameEngine.h"
+#include "AssetCache.h"
 #include <string>
 #include <vector>
+#include <unordered_map>
 #include <iostream>
 #include "Point.h"
 
-const int LETTERS = 26;
-const int NUMBERS = 10;
-const int ALPHABET = LETTERS + NUMBERS;
+// A font is one sprite sheet, <folder>/atlas.spr, holding the glyphs of
+// FONT_CHARSET left to right in equally wide slots. The slot width is the
+// sheet's width divided by FONT_GLYPHS, glyphs sit in the top left corner
+// of their slot and advance by their drawn width plus one
+const char FONT_CHARSET[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ.,:!?'-+/()%";
+const int FONT_GLYPHS = sizeof(FONT_CHARSET) - 1;
+
+// Slot of every byte. Lowercase letters share the uppercase glyphs, bytes
+// without a glyph get FONT_SPACE, which draws nothing and advances a slot
+const int FONT_SPACE = FONT_GLYPHS;
+
+struct sFontSlots {
+	uint8_t slot[256];
+
+	constexpr sFontSlots() : slot() {
+		for (int c = 0; c < 256; c++)
+			slot[c] = FONT_SPACE;
+		for (int i = 0; i < FONT_GLYPHS; i++)
+			slot[(unsigned char) FONT_CHARSET[i]] = (uint8_t) i;
+		for (int c = 'a'; c <= 'z'; c++)
+			slot[c] = slot[c - 'a' + 'A'];
+	}
+};
+
+constexpr sFontSlots FONT_SLOTS;
 
 const int FONT_HEIGHT = 7;
 const int FONT_WIDTH = 5;
 
 class Font {
 public:
-	Font(std::wstring fontFolder);
+	Font(AssetCache& assets, std::wstring fontFolder);
 	~Font();
 
-	void DrawString(ConsoleGameEngine* engine, std::string str, int x, int y);
-	void DrawString(ConsoleGameEngine* engine, std::string str, Point position);
+	// Strings are rendered once into a text run and copied to the screen
+	// from there while they stay the same, see sTextRun
+	void DrawString(ConsoleGameEngine* engine, const std::string& str, int x, int y);
+	void DrawString(ConsoleGameEngine* engine, const std::string& str, Point position);
 	void Endl() ;
 	Point GetLastPosition() const ;
+	int Height() const;
 
-	void OpenFolder(std::wstring fontFolder);
-	bool LoadFont();
+	bool LoadFont(AssetCache& assets, std::wstring fontFolder);
 
 private:
-	std::wstring fontPath[ALPHABET];
-	Sprite fontSpr[ALPHABET];
+	// Where a glyph is in the atlas and how far it moves the pen
+	struct sGlyph {
+		int x = 0;
+		int nWidth = 0;
+		int nAdvance = 0;
+	};
+
+	std::wstring folder;
+	std::shared_ptr<const Sprite> atlas;
+	sGlyph glyphs[FONT_GLYPHS + 1];
+
+	// A string with its glyphs composited into one block of cells, drawn
+	// with a single DrawCellsMasked(). The mask lets the blank cells
+	// between the strokes show what is underneath, like DrawSprite() does
+	struct sTextRun {
+		int nWidth = 0;
+		std::vector<CHAR_INFO> cells;
+		std::vector<uint32_t> mask;
+		unsigned int nLastUsed = 0;
+	};
+
+	// Enough for the HUD's labels and numbers, the least recently drawn
+	// string makes room for a new one
+	static const size_t MAX_TEXT_RUNS = 32;
+
+	std::unordered_map<std::string, sTextRun> textRuns;
+	unsigned int drawCount;
+	AssetCache* assets;
+	unsigned int assetGeneration;
 
 private:
-	int GetSpriteIndex(char c);
+	const sGlyph& GetGlyph(char c) const;
+	void MeasureGlyphs();
+	const sTextRun& GetTextRun(const std::string& str);
+	void BuildTextRun(const std::string& str, sTextRun& run);
 	Point last;
 	Point start;
 	int width;
@@ -1,9 +1,147 @@
 #include "Game.h"
+#include "Simulation.h"
+#include "RasterBenchmark.h"
+#include <string>
+#include <cstring>
+#include <cstdlib>
+
+static std::wstring Widen(const char* str) {
+	return std::wstring(str, str + strlen(str));
+}
+
+static int RunSimulation(int nRuns, const GameConfig& config, BOT_TYPE bot, unsigned int nSeed, unsigned int nThreads, const std::wstring& sPackFile) {
+	ThreadPool pool(nThreads);
+	Simulation sim(config, bot);
+	sim.SetSeed(nSeed);
+	sim.Assets().OpenPack(sPackFile);
+
+	wprintf(L"Simulating %d runs on %u threads: %d NPC, delay %.4fs, speed up %.4f\n",
+			nRuns, pool.Size(), config.nNpc, config.fDelay, config.fSpeedUp);
+
+	auto tp1 = std::chrono::steady_clock::now();
+	std::vector<sSimulationResult> results = sim.Run(pool, nRuns);
+	auto tp2 = std::chrono::steady_clock::now();
+
+	Simulation::Report(results, std::chrono::duration<double>(tp2 - tp1).count());
+	sim.Assets().Report();
+	return 0;
+}
+
+int main(int argc, char** argv) {
+	// --record <file>  save this session's input so it can be reproduced
+	// --replay <file>  play back a recorded session instead of live input,
+	//                  with the --npc, --track, --3d etc. it was recorded with
+	// --seed <n>       start from a fixed random seed
+	// --pack <file>    asset pack to load from, loose files under assets/
+	//                  are used for anything missing. Default assets.pak
+	// --watch          reload sprites from assets/ as soon as they are saved
+	// --track <seed>   race on a winding road laid out from seed
+	// --3d             see the road from behind the player
+	//
+	// --simulate <n>   run n headless sessions with a bot instead of playing,
+	//                  tuned with --npc <n> --delay <s> --speedup <f>
+	//                  --bot idle|random|dodge --threads <n>
+	//
+	// --bench-raster <n>  draw n frames of a 400x250 scene serially and in
+	//                  tiles on 1 up to --threads <n> threads
+	const char* sRecordFile = nullptr;
+	const char* sReplayFile = nullptr;
+	bool bSeed = false;
+	bool bWatch = false;
+	int nSimulate = 0;
+	int nBenchRaster = 0;
+	unsigned int nSeed = 1;
+	unsigned int nThreads = 0;
+	GameConfig config;
+	BOT_TYPE bot = BOT_DODGE;
+	std::wstring sPackFile = L"assets.pak";
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--watch") == 0) {
+			bWatch = true;
+			continue;
+		}
+
+		if (strcmp(argv[i], "--3d") == 0) {
+			config.bPerspective = true;
+			continue;
+		}
+
+		// Everything else takes a value
+		if (i == argc - 1)
+			break;
+
+		if (strcmp(argv[i], "--record") == 0) {
+			sRecordFile = argv[++i];
+		} else if (strcmp(argv[i], "--replay") == 0) {
+			sReplayFile = argv[++i];
+		} else if (strcmp(argv[i], "--seed") == 0) {
+			nSeed = (unsigned int) strtoul(argv[++i], nullptr, 10);
+			bSeed = true;
+		} else if (strcmp(argv[i], "--pack") == 0) {
+			sPackFile = Widen(argv[++i]);
+		} else if (strcmp(argv[i], "--simulate") == 0) {
+			nSimulate = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--bench-raster") == 0) {
+			nBenchRaster = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--track") == 0) {
+			config.nTrackSeed = (unsigned int) strtoul(argv[++i], nullptr, 10);
+		} else if (strcmp(argv[i], "--npc") == 0) {
+			// The NPCs are spread over the road by their count, keep the
+			// default rather than take none
+			int nNpc = atoi(argv[++i]);
+			if (nNpc >= 1)
+				config.nNpc = nNpc;
+		} else if (strcmp(argv[i], "--delay") == 0) {
+			config.fDelay = (float) atof(argv[++i]);
+		} else if (strcmp(argv[i], "--speedup") == 0) {
+			config.fSpeedUp = (float) atof(argv[++i]);
+		} else if (strcmp(argv[i], "--threads") == 0) {
+			nThreads = (unsigned int) atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--bot") == 0) {
+			i++;
+			if (strcmp(argv[i], "idle") == 0) bot = BOT_IDLE;
+			else if (strcmp(argv[i], "random") == 0) bot = BOT_RANDOM;
+			else bot = BOT_DODGE;
+		}
+	}
+
+	if (nSimulate > 0)
+		return RunSimulation(nSimulate, config, bot, nSeed, nThreads, sPackFile);
+
+	if (nBenchRaster > 0) {
+		RasterBenchmark bench(400, 250);
+		bench.Assets().OpenPack(sPackFile);
+		bench.Run(nBenchRaster, nThreads, 64, 32);
+		return 0;
+	}
+
+	Game racing(config);
+	racing.Assets().OpenPack(sPackFile);
+
+	if (bWatch && !racing.WatchAssets(L"assets"))
+		wprintf(L"WARNING: Could not watch assets/ for changes\n");
+
+	if (bSeed)
+		racing.SetRandomSeed(nSeed);
+
+	if (sRecordFile != nullptr && !racing.RecordInput(Widen(sRecordFile))) {
+		wprintf(L"ERROR: Could not create input log %S\n", sRecordFile);
+		return 1;
+	}
+
+	if (sReplayFile != nullptr && !racing.ReplayInput(Widen(sReplayFile))) {
+		wprintf(L"ERROR: Could not open input log %S\n", sReplayFile);
+		return 1;
+	}
 
-int main() {
-	Game racing;
 	racing.ConstructConsole(SCREEN_WIDTH, SCREEN_HEIGHT, PIXEL_SIZE, PIXEL_SIZE);
 	racing.Start();
 
+	if (racing.TimeToFirstFrame() >= 0.0f)
+		wprintf(L"time to first frame: %.3fs\n", racing.TimeToFirstFrame());
+	if (racing.TimeToLoaded() >= 0.0f)
+		wprintf(L"time to fully loaded: %.3fs\n", racing.TimeToLoaded());
+
 	return 0;
-}
\ No newline at end of file
+}